@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace governance::bench {
+
+/// Number of heap allocations performed by the process so far. Counted by the
+/// global operator new replacement in bench_main.cpp.
+std::uint64_t allocation_count();
+
+/// Keeps the optimizer from discarding a computed value.
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+struct Options {
+    std::size_t repetitions     = 5;      // timed runs per benchmark; ns/op is their median
+    std::size_t latency_samples = 10000;  // individually timed calls for p50/p99
+    double      scale           = 1.0;    // multiplier on every benchmark's iteration count
+    std::string filter;                   // run only benchmarks whose name contains this
+    bool        json            = false;  // machine-readable output on stdout
+};
+
+struct Result {
+    std::string name;
+    std::size_t iterations    = 0;    // calls per repetition
+    std::size_t repetitions   = 0;
+    std::size_t items         = 1;    // items processed per call (batch APIs)
+    double      ns_per_op     = 0.0;  // median over repetitions, per item
+    double      ns_min        = 0.0;
+    double      ns_max        = 0.0;
+    double      allocs_per_op = 0.0;
+    double      p50_ns        = 0.0;  // per-call latency percentiles, per item;
+    double      p99_ns        = 0.0;  // include one clock read of overhead
+};
+
+/**
+ * Runner
+ *
+ * Executes benchmarks with a warmup pass, `repetitions` timed passes and a
+ * latency pass that times calls individually. Results are printed as a table
+ * (stderr when --json is set) and kept for JSON output.
+ */
+class Runner {
+public:
+    explicit Runner(Options options) : options_(std::move(options)) {}
+
+    const Options&             options() const { return options_; }
+    const std::vector<Result>& results() const { return results_; }
+
+    /// Prints a section header.
+    void section(const std::string& title) const { out() << "\n[" << title << "]\n"; }
+
+    /// Benchmarks `body(i)`. `items` is the number of elements each call
+    /// processes; times and allocations are reported per element.
+    template <typename Fn>
+    void run(const std::string& name, std::size_t iterations, Fn&& body, std::size_t items = 1) {
+        if (!options_.filter.empty() && name.find(options_.filter) == std::string::npos) return;
+
+        using Clock = std::chrono::steady_clock;
+        iterations = std::max<std::size_t>(1, static_cast<std::size_t>(
+                         static_cast<double>(iterations) * options_.scale));
+        const std::size_t reps = std::max<std::size_t>(1, options_.repetitions);
+
+        // Warmup: fill caches, fault in pages, let lazy statics initialise.
+        for (std::size_t i = 0; i < std::max<std::size_t>(1, iterations / 10); ++i) body(i);
+
+        std::vector<double> per_rep;
+        per_rep.reserve(reps);
+        const auto allocs_before = allocation_count();
+        for (std::size_t r = 0; r < reps; ++r) {
+            const auto start = Clock::now();
+            for (std::size_t i = 0; i < iterations; ++i) body(i);
+            const auto stop  = Clock::now();
+            per_rep.push_back(std::chrono::duration<double, std::nano>(stop - start).count()
+                              / static_cast<double>(iterations));
+        }
+        const auto allocs_after = allocation_count();
+
+        const std::size_t samples = std::min(iterations, options_.latency_samples);
+        std::vector<double> latency(samples);
+        for (std::size_t i = 0; i < samples; ++i) {
+            const auto start = Clock::now();
+            body(i);
+            const auto stop  = Clock::now();
+            latency[i] = std::chrono::duration<double, std::nano>(stop - start).count();
+        }
+
+        const double n = static_cast<double>(items);
+        Result r;
+        r.name          = name;
+        r.iterations    = iterations;
+        r.repetitions   = reps;
+        r.items         = items;
+        r.ns_per_op     = percentile(per_rep, 0.5) / n;
+        r.ns_min        = *std::min_element(per_rep.begin(), per_rep.end()) / n;
+        r.ns_max        = *std::max_element(per_rep.begin(), per_rep.end()) / n;
+        r.allocs_per_op = static_cast<double>(allocs_after - allocs_before)
+                          / static_cast<double>(iterations * reps) / n;
+        r.p50_ns        = percentile(latency, 0.50) / n;
+        r.p99_ns        = percentile(latency, 0.99) / n;
+
+        print(r);
+        results_.push_back(std::move(r));
+    }
+
+    void write_json(std::ostream& os) const;
+
+private:
+    static double percentile(std::vector<double> values, double q) {
+        if (values.empty()) return 0.0;
+        const auto k = static_cast<std::size_t>(q * static_cast<double>(values.size() - 1) + 0.5);
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(k), values.end());
+        return values[k];
+    }
+
+    std::ostream& out() const { return options_.json ? std::cerr : std::cout; }
+    void          print(const Result& r) const;
+
+    Options             options_;
+    std::vector<Result> results_;
+};
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void run_policy_engine_benches(Runner& runner);
+void run_compliance_benches(Runner& runner);
+void run_json_benches(Runner& runner);
+
+} // namespace governance::bench
@@ -0,0 +1,259 @@
+#include "bench.hpp"
+
+#include "governance/columnar_inventory.hpp"
+#include "governance/compliance.hpp"
+#include "governance/incremental_compliance.hpp"
+#include "governance/inventory_snapshot.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace governance::bench {
+
+namespace {
+
+// Compliant and non-compliant resources in roughly equal measure, so both
+// the pass path and violation formatting are exercised.
+std::vector<Resource> resource_mix() {
+    return {
+        { "db-patient-records",  "database", "restricted",   { {"owner", "health-team"}, {"region", "us-west-2"} } },
+        { "storage-public-docs", "storage",  "public",       { {"owner", "marketing"} } },
+        { "compute-prod-api",    "compute",  "confidential", { {"env", "production"}, {"owner", "platform-team"} } },
+        { "db-legacy-public",    "database", "public",       {} },
+        { "secret-api-key",      "secret",   "public",       { {"owner", "devops"} } },
+        { "mystery-box",         "storage",  "",             {} },
+    };
+}
+
+} // namespace
+
+void run_compliance_benches(Runner& runner) {
+    runner.section("ComplianceChecker");
+
+    const auto checker   = default_compliance_checker();
+    const auto resources = resource_mix();
+    const std::size_t iterations = 200000;
+
+    runner.run("ComplianceChecker::evaluate", iterations, [&](std::size_t i) {
+        auto report = checker.evaluate(resources[i % resources.size()]);
+        do_not_optimize(report);
+    });
+
+    runner.run("ComplianceChecker::evaluate (compliant)", iterations, [&](std::size_t) {
+        auto report = checker.evaluate(resources[0]);
+        do_not_optimize(report);
+    });
+
+    runner.run("ComplianceChecker::evaluate (3 violations)", iterations, [&](std::size_t) {
+        auto report = checker.evaluate(resources[5]);
+        do_not_optimize(report);
+    });
+
+    // ── Tags ─────────────────────────────────────────────────────────────────
+    // What a resource's tags cost to copy (as every trace and inventory copy
+    // does) and to query, for the two-tag resource above.
+    runner.section("Resource tags");
+
+    runner.run("Resource copy (2 tags)", iterations, [&](std::size_t) {
+        Resource copy = resources[0];
+        do_not_optimize(copy);
+    });
+
+    runner.run("Resource tags lookup (text key)", iterations, [&](std::size_t i) {
+        auto found = resources[i % resources.size()].tags.count("owner");
+        do_not_optimize(found);
+    });
+
+    const Symbol owner_key("owner");
+    runner.run("Resource tags lookup (Symbol key)", iterations, [&](std::size_t i) {
+        auto found = resources[i % resources.size()].tags.contains(owner_key);
+        do_not_optimize(found);
+    });
+
+    // ── Early exit ───────────────────────────────────────────────────────────
+    // What a gate pays when it needs less than a full report, over the mix.
+    runner.section("ComplianceChecker modes");
+
+    auto evaluate_mix = [&](const ComplianceChecker& c, const std::string& suffix) {
+        runner.run("ComplianceChecker::evaluate" + suffix, iterations, [&](std::size_t i) {
+            auto report = c.evaluate(resources[i % resources.size()]);
+            do_not_optimize(report);
+        });
+        runner.run("ComplianceChecker::count_violations" + suffix, iterations, [&](std::size_t i) {
+            auto count = c.count_violations(resources[i % resources.size()]);
+            do_not_optimize(count);
+        });
+        runner.run("ComplianceChecker::first_violation" + suffix, iterations, [&](std::size_t i) {
+            auto violation = c.first_violation(resources[i % resources.size()]);
+            do_not_optimize(violation);
+        });
+        runner.run("ComplianceChecker::is_compliant" + suffix, iterations, [&](std::size_t i) {
+            auto ok = c.is_compliant(resources[i % resources.size()]);
+            do_not_optimize(ok);
+        });
+    };
+    evaluate_mix(checker, "");
+
+    // Reordered by cost and the failure rate observed over the mix itself.
+    auto ordered = checker;
+    ordered.order_rules(ordered.summarize(resources));
+    evaluate_mix(ordered, " (ordered)");
+
+    // ── Incremental ──────────────────────────────────────────────────────────
+    // A change event that toggles the owner tag: re-running the affected rule
+    // against evaluating the changed resource in full.
+    runner.section("IncrementalComplianceChecker");
+
+    IncrementalComplianceChecker incremental(checker);
+    incremental.upsert(resources[0]);
+    const ResourceDelta toggles[] = {
+        { resources[0].id, std::nullopt, std::nullopt, { { Symbol("owner"), std::nullopt } } },
+        { resources[0].id, std::nullopt, std::nullopt, { { Symbol("owner"), std::string("health-team") } } },
+    };
+    Resource updated = resources[0];
+    const Symbol owner("owner");
+
+    runner.run("ComplianceChecker::evaluate (after owner change)", iterations, [&](std::size_t i) {
+        if (i % 2) updated.tags.set(owner, "health-team"); else updated.tags.erase(owner);
+        auto report = checker.evaluate(updated);
+        do_not_optimize(report);
+    });
+
+    runner.run("IncrementalComplianceChecker::apply (owner change)", iterations, [&](std::size_t i) {
+        const auto& report = incremental.apply(toggles[i % 2]);
+        do_not_optimize(report);
+    });
+
+    runner.run("IncrementalComplianceChecker::apply (no change)", iterations, [&](std::size_t) {
+        const auto& report = incremental.apply(toggles[1]);
+        do_not_optimize(report);
+    });
+
+    runner.run("IncrementalComplianceChecker::upsert (owner change)", iterations, [&](std::size_t i) {
+        if (i % 2) updated.tags.set(owner, "health-team"); else updated.tags.erase(owner);
+        const auto& report = incremental.upsert(updated);
+        do_not_optimize(report);
+    });
+
+    // ── Parallel scan ────────────────────────────────────────────────────────
+    // Per-resource cost of scanning 100k resources as the pool grows to core count.
+    runner.section("ComplianceChecker scan, 100000 resources");
+
+    std::vector<Resource> inventory;
+    inventory.reserve(100000);
+    for (std::size_t i = 0; i < 100000; ++i) inventory.push_back(resources[i % resources.size()]);
+    std::vector<ComplianceReport> reports(inventory.size());
+
+    const std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= cores; threads *= 2) {
+        auto pooled = checker;
+        pooled.set_concurrency(threads);
+        const std::string suffix = " x" + std::to_string(threads) + " threads";
+
+        runner.run("ComplianceChecker::scan" + suffix, 10, [&](std::size_t) {
+            pooled.scan(inventory.data(), inventory.size(), reports.data());
+            do_not_optimize(reports);
+        }, inventory.size());
+
+        std::size_t violations = 0;
+        runner.run("ComplianceChecker::scan (sink)" + suffix, 10, [&](std::size_t) {
+            pooled.scan(inventory, [&](std::size_t, ComplianceReport&& report) {
+                violations += report.violations.size();
+            });
+            do_not_optimize(violations);
+        }, inventory.size());
+
+        runner.run("ComplianceChecker::summarize" + suffix, 10, [&](std::size_t) {
+            auto summary = pooled.summarize(inventory);
+            do_not_optimize(summary);
+        }, inventory.size());
+
+        if (threads < cores && threads * 2 > cores) threads = cores / 2;
+    }
+
+    // ── Columnar inventory ───────────────────────────────────────────────────
+    // A million-resource summary, row by row and over columns, single-threaded.
+    // The mix is half non-compliant, so copying 500k ids into the summary is a
+    // large share of the columnar figure; the clean (all compliant) inventory
+    // shows the rule kernels alone.
+    runner.section("ComplianceChecker summarize, 1000000 resources");
+
+    std::vector<Resource> large, compliant;
+    large.reserve(1000000);
+    compliant.reserve(1000000);
+    for (std::size_t i = 0; i < 1000000; ++i) {
+        large.push_back(resources[i % resources.size()]);
+        compliant.push_back(resources[i % 3]);
+    }
+
+    runner.run("ColumnarInventory build", 3, [&](std::size_t) {
+        ColumnarInventory columns(large);
+        do_not_optimize(columns);
+    }, large.size());
+
+    for (const auto* inventory : { &large, &compliant }) {
+        const std::string label = inventory == &large ? "mix" : "clean";
+        const ColumnarInventory columns(*inventory);
+
+        runner.run("ComplianceChecker::summarize (rows, " + label + ")", 3, [&](std::size_t) {
+            auto summary = checker.summarize(*inventory);
+            do_not_optimize(summary);
+        }, inventory->size());
+
+        runner.run("ComplianceChecker::summarize (columns, " + label + ")", 3, [&](std::size_t) {
+            auto summary = checker.summarize(columns);
+            do_not_optimize(summary);
+        }, inventory->size());
+    }
+
+    // ── Inventory snapshot ───────────────────────────────────────────────────
+    // The same million resources written to a snapshot file. open() + the
+    // first evaluate is the cold-start cost: constant, whatever the inventory
+    // size. The summary decodes every record, so compare it with the rows.
+    runner.section("InventorySnapshot, 1000000 resources");
+
+    const std::string path = "bench_inventory.snapshot";
+    {
+        SnapshotWriter writer;
+        runner.run("SnapshotWriter::add", 100000, [&](std::size_t i) {
+            writer.add(large[i % large.size()]);
+        });
+    }
+    {
+        SnapshotWriter writer;
+        for (const auto& r : large) writer.add(r);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        writer.write(out);
+    }
+
+    runner.run("InventorySnapshot::open + first evaluate", 1000, [&](std::size_t) {
+        const auto snapshot = InventorySnapshot::open(path);
+        auto report = checker.evaluate(snapshot.read(0));
+        do_not_optimize(report);
+    });
+
+    {
+        const auto snapshot = InventorySnapshot::open(path);
+        Resource scratch;
+        runner.run("InventorySnapshot::read", 100000, [&](std::size_t i) {
+            snapshot.read(i % snapshot.size(), scratch);
+            do_not_optimize(scratch);
+        });
+
+        runner.run("InventorySnapshot::validate", 3, [&](std::size_t) {
+            snapshot.validate();
+        }, snapshot.size());
+
+        runner.run("ComplianceChecker::summarize (snapshot, mix)", 3, [&](std::size_t) {
+            auto summary = checker.summarize(snapshot);
+            do_not_optimize(summary);
+        }, snapshot.size());
+    }
+    std::remove(path.c_str());
+}
+
+} // namespace governance::bench
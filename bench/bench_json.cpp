@@ -0,0 +1,81 @@
+#include "bench.hpp"
+
+#include "governance/json.hpp"
+#include "governance/resource_reader.hpp"
+
+#include <optional>
+#include <sstream>
+#include <string>
+
+namespace governance::bench {
+
+void run_json_benches(Runner& runner) {
+    runner.section("JSON serialization");
+
+    const auto engine  = default_policy_engine();
+    const auto checker = default_compliance_checker();
+
+    RequestContext ctx {
+        { "alice@corp.io", "admin", "IT" },
+        { "db-patient-records", "database", "restricted", { {"owner", "health-team"} } },
+        { "read" }, "production", true
+    };
+    const auto result   = engine.evaluate(ctx);
+    const auto& step    = result.trace.steps.front();
+    const auto decision = result.decision;
+    const auto report   = checker.evaluate({ "db-legacy-public", "database", "public", {} });
+    const std::size_t iterations = 100000;
+
+    runner.run("to_json(PolicyDecision)", iterations, [&](std::size_t) {
+        auto json = to_json(decision);
+        do_not_optimize(json);
+    });
+
+    runner.run("to_json(PolicyStep)", iterations, [&](std::size_t) {
+        auto json = to_json(step);
+        do_not_optimize(json);
+    });
+
+    runner.run("to_json(EvaluationResult)", iterations, [&](std::size_t) {
+        auto json = to_json(result);
+        do_not_optimize(json);
+    });
+
+    runner.run("to_json(ComplianceReport)", iterations, [&](std::size_t) {
+        auto json = to_json(report);
+        do_not_optimize(json);
+    });
+
+    std::ostringstream sink;
+    runner.run("write_json_line(ComplianceReport)", iterations, [&](std::size_t i) {
+        if (i % 1024 == 0) sink.str(std::string());   // keep the stream's buffer small
+        write_json_line(sink, report);
+    });
+
+    // ── JSONL input ──────────────────────────────────────────────────────────
+    // Steady-state parsing of an export whose records share their tag keys:
+    // after the first record, the reader and the Resource reuse their storage.
+    // The export is replayed from the start when the reader reaches its end.
+    runner.section("JSONL input");
+
+    std::string export_text;
+    for (std::size_t i = 0; i < 10000; ++i) {
+        export_text += "{\"id\": \"db-" + std::to_string(i) +
+                       "-patient-records\", \"type\": \"database\", \"classification\": \"restricted\", "
+                       "\"tags\": {\"owner\": \"health-team\", \"region\": \"us-west-2\"}}\n";
+    }
+    std::istringstream in(export_text);
+    std::optional<ResourceReader> reader(std::in_place, in);
+    Resource resource;
+    runner.run("ResourceReader::next", iterations, [&](std::size_t) {
+        if (!reader->next(resource)) {
+            in.clear();
+            in.seekg(0);
+            reader.emplace(in);
+            reader->next(resource);
+        }
+        do_not_optimize(resource);
+    });
+}
+
+} // namespace governance::bench
@@ -0,0 +1,120 @@
+#include "bench.hpp"
+
+#include "governance/json.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <new>
+#include <thread>
+
+// ── Allocation counting ───────────────────────────────────────────────────────
+//
+// Replacing the global allocation functions lets every suite report heap
+// allocations per operation without an external profiler.
+
+namespace {
+std::atomic<std::uint64_t> g_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace governance::bench {
+
+std::uint64_t allocation_count() {
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+// ── Reporting ─────────────────────────────────────────────────────────────────
+
+void Runner::print(const Result& r) const {
+    out() << "  " << std::left << std::setw(46) << r.name << std::right
+          << std::fixed << std::setprecision(1)
+          << std::setw(10) << r.ns_per_op     << " ns/op"
+          << std::setw(8)  << r.allocs_per_op << " allocs/op"
+          << "   p50 " << std::setw(8) << r.p50_ns
+          << "  p99 "  << std::setw(8) << r.p99_ns << "\n";
+}
+
+void Runner::write_json(std::ostream& os) const {
+    using json_detail::quoted;
+    os << std::fixed << std::setprecision(2)
+       << "{\n"
+       << "  \"context\": {\n"
+       << "    \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n"
+       << "    \"repetitions\": "      << options_.repetitions << ",\n"
+       << "    \"scale\": "            << options_.scale << "\n"
+       << "  },\n"
+       << "  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results_.size(); ++i) {
+        const auto& r = results_[i];
+        os << "\n    { \"name\": "          << quoted(r.name)
+           << ", \"iterations\": "          << r.iterations
+           << ", \"repetitions\": "         << r.repetitions
+           << ", \"items_per_call\": "      << r.items
+           << ", \"ns_per_op\": "           << r.ns_per_op
+           << ", \"ns_min\": "              << r.ns_min
+           << ", \"ns_max\": "              << r.ns_max
+           << ", \"allocs_per_op\": "       << r.allocs_per_op
+           << ", \"p50_ns\": "              << r.p50_ns
+           << ", \"p99_ns\": "              << r.p99_ns
+           << " }";
+        if (i + 1 < results_.size()) os << ",";
+    }
+    os << "\n  ]\n"
+       << "}\n";
+}
+
+} // namespace governance::bench
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+static void usage(const char* argv0) {
+    std::cerr << "usage: " << argv0 << " [--json] [--filter SUBSTRING] [--repetitions N]\n"
+              << "       [--latency-samples N] [--scale FACTOR] [--quick]\n";
+}
+
+int main(int argc, char** argv) {
+    governance::bench::Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg  = argv[i];
+        const bool  more = i + 1 < argc;
+        if (std::strcmp(arg, "--json") == 0) {
+            options.json = true;
+        } else if (std::strcmp(arg, "--filter") == 0 && more) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(arg, "--repetitions") == 0 && more) {
+            options.repetitions = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--latency-samples") == 0 && more) {
+            options.latency_samples = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--scale") == 0 && more) {
+            options.scale = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(arg, "--quick") == 0) {
+            options.scale           = 0.01;
+            options.repetitions     = 1;
+            options.latency_samples = 100;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    governance::bench::Runner runner(options);
+    (options.json ? std::cerr : std::cout) << "=== Governance Benchmarks ===\n";
+
+    governance::bench::run_policy_engine_benches(runner);
+    governance::bench::run_compliance_benches(runner);
+    governance::bench::run_json_benches(runner);
+
+    if (options.json) runner.write_json(std::cout);
+    return 0;
+}
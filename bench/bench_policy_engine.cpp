@@ -0,0 +1,244 @@
+#include "bench.hpp"
+
+#include "governance/decision_cache.hpp"
+#include "governance/decision_table.hpp"
+#include "governance/policy_engine.hpp"
+#include "governance/static_policy_engine.hpp"
+#include "governance/trace_arena.hpp"
+#include "governance/versioned_policy_engine.hpp"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace governance::bench {
+
+namespace {
+
+// A mix of requests that exercises every built-in policy: admin bypass,
+// MFA deny, production immutability, analyst limits and engineer access.
+std::vector<RequestContext> request_mix() {
+    Resource patient_db  { "db-patient-records",  "database", "restricted",
+                           { {"owner", "health-team"}, {"region", "us-west-2"} } };
+    Resource public_docs { "storage-public-docs", "storage",  "public",
+                           { {"owner", "marketing"} } };
+    Resource prod_api    { "compute-prod-api",    "compute",  "confidential",
+                           { {"env", "production"}, {"owner", "platform-team"} } };
+
+    Principal alice { "alice@corp.io", "admin",    "IT"         };
+    Principal bob   { "bob@corp.io",   "engineer", "Backend"    };
+    Principal carol { "carol@corp.io", "analyst",  "DataSci"    };
+    Principal dave  { "dave@corp.io",  "guest",    "Consulting" };
+
+    return {
+        { alice, patient_db,  {"read"},  "production", true  },
+        { bob,   prod_api,    {"write"}, "production", false },
+        { bob,   prod_api,    {"read"},  "production", false },
+        { bob,   prod_api,    {"write"}, "staging",    false },
+        { carol, public_docs, {"read"},  "dev",        false },
+        { carol, patient_db,  {"read"},  "production", true  },
+        { dave,  public_docs, {"read"},  "dev",        false },
+        { bob,   patient_db,  {"read"},  "staging",    true  },
+    };
+}
+
+// Every combination of the built-ins' attributes: 864 distinct cache keys,
+// so concurrent lookups spread over the cache rather than one hot entry.
+std::vector<RequestContext> wide_request_mix() {
+    std::vector<RequestContext> requests;
+    for (const char* role : { "admin", "engineer", "analyst", "guest" })
+        for (const char* type : { "database", "storage", "compute" })
+            for (const char* classification : { "public", "confidential", "restricted" })
+                for (const char* verb : { "read", "write", "delete", "admin" })
+                    for (const char* env : { "dev", "staging", "production" })
+                        for (bool mfa : { false, true })
+                            requests.push_back({ { "p@corp.io", role, "Dept" },
+                                                 { "r", type, classification, {} },
+                                                 { verb }, env, mfa });
+    return requests;
+}
+
+// 50 roles with 4 policies each, as in a deployment with many role-specific
+// rules. With `indexed` set each policy declares its role precondition.
+PolicyEngine role_specific_engine(bool indexed) {
+    PolicyEngine engine;
+    for (int r = 0; r < 50; ++r) {
+        const Symbol role { "role-" + std::to_string(r) };
+        for (int p = 0; p < 4; ++p) {
+            Policy policy {
+                "Role" + std::to_string(r) + "Policy" + std::to_string(p), "1.0", "bench", "",
+                [role](const RequestContext& ctx) -> std::optional<PolicyDecision> {
+                    if (ctx.principal.role != role || ctx.action.verb != symbols::verb_delete)
+                        return std::nullopt;
+                    return PolicyDecision{ Effect::Deny, "RolePolicy", "Role may not delete." };
+                },
+                { Attribute::Role }
+            };
+            if (indexed) policy.applies_to.roles = { role };
+            engine.register_policy(std::move(policy));
+        }
+    }
+    engine.register_policy(admin_full_access());
+    return engine;
+}
+
+} // namespace
+
+void run_policy_engine_benches(Runner& runner) {
+    runner.section("PolicyEngine");
+
+    const auto engine   = default_policy_engine();
+    const auto requests = request_mix();
+    const std::size_t iterations = 200000;
+
+    runner.run("PolicyEngine::evaluate", iterations, [&](std::size_t i) {
+        auto result = engine.evaluate(requests[i % requests.size()]);
+        do_not_optimize(result);
+    });
+
+    TraceArena arena;
+    runner.run("PolicyEngine::evaluate (arena)", iterations, [&](std::size_t i) {
+        arena.reset();
+        auto view = engine.evaluate(requests[i % requests.size()], arena);
+        do_not_optimize(view);
+    });
+
+    runner.run("PolicyEngine::decide", iterations, [&](std::size_t i) {
+        auto effect = engine.decide(requests[i % requests.size()]);
+        do_not_optimize(effect);
+    });
+
+    auto counted = engine;
+    counted.enable_counters();
+    runner.run("PolicyEngine::decide (counters)", iterations, [&](std::size_t i) {
+        auto effect = counted.decide(requests[i % requests.size()]);
+        do_not_optimize(effect);
+    });
+
+    auto profiled = engine;
+    profiled.enable_profiling();
+    runner.run("PolicyEngine::decide (profiling)", iterations, [&](std::size_t i) {
+        auto effect = profiled.decide(requests[i % requests.size()]);
+        do_not_optimize(effect);
+    });
+
+    const VersionedPolicyEngine versioned(engine);
+    runner.run("VersionedPolicyEngine::decide", iterations, [&](std::size_t i) {
+        auto effect = versioned.decide(requests[i % requests.size()]);
+        do_not_optimize(effect);
+    });
+
+    auto cached = engine;
+    cached.enable_cache(4096);
+
+    runner.run("PolicyEngine::evaluate (cached)", iterations, [&](std::size_t i) {
+        auto result = cached.evaluate(requests[i % requests.size()]);
+        do_not_optimize(result);
+    });
+
+    runner.run("PolicyEngine::evaluate (cached, arena)", iterations, [&](std::size_t i) {
+        arena.reset();
+        auto view = cached.evaluate(requests[i % requests.size()], arena);
+        do_not_optimize(view);
+    });
+
+    runner.run("PolicyEngine::decide (cached)", iterations, [&](std::size_t i) {
+        auto effect = cached.decide(requests[i % requests.size()]);
+        do_not_optimize(effect);
+    });
+
+    const DefaultStaticPolicyEngine static_engine;
+
+    runner.run("StaticPolicyEngine::evaluate", iterations, [&](std::size_t i) {
+        auto result = static_engine.evaluate(requests[i % requests.size()]);
+        do_not_optimize(result);
+    });
+
+    runner.run("StaticPolicyEngine::decide", iterations, [&](std::size_t i) {
+        auto effect = static_engine.decide(requests[i % requests.size()]);
+        do_not_optimize(effect);
+    });
+
+    const auto table = DecisionTable::compile(engine);
+
+    runner.run("DecisionTable::decide", iterations, [&](std::size_t i) {
+        auto effect = table.decide(requests[i % requests.size()]);
+        do_not_optimize(effect);
+    });
+
+    // ── Role index ───────────────────────────────────────────────────────────
+    runner.section("PolicyEngine, 200 role-specific policies");
+
+    const auto unindexed = role_specific_engine(false);
+    const auto indexed   = role_specific_engine(true);
+    RequestContext role_request = requests[0];
+    role_request.principal.role = "role-7";
+
+    runner.run("PolicyEngine::decide (no preconditions)", iterations / 10, [&](std::size_t) {
+        auto effect = unindexed.decide(role_request);
+        do_not_optimize(effect);
+    });
+
+    runner.run("PolicyEngine::decide (role index)", iterations / 10, [&](std::size_t) {
+        auto effect = indexed.decide(role_request);
+        do_not_optimize(effect);
+    });
+
+    // ── Batch scaling ────────────────────────────────────────────────────────
+    // Per-request cost of a 10k-request batch as the pool grows to core count.
+    runner.section("PolicyEngine batch, 10000 requests");
+
+    std::vector<RequestContext> batch;
+    batch.reserve(10000);
+    for (std::size_t i = 0; i < 10000; ++i) batch.push_back(requests[i % requests.size()]);
+    std::vector<Effect>           effects(batch.size());
+    std::vector<EvaluationResult> results(batch.size());
+
+    const std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= cores; threads *= 2) {
+        auto pooled = engine;
+        pooled.set_concurrency(threads);
+        const std::string suffix = " x" + std::to_string(threads) + " threads";
+
+        runner.run("PolicyEngine::decide_batch" + suffix, 50, [&](std::size_t) {
+            pooled.decide_batch(batch.data(), batch.size(), effects.data());
+            do_not_optimize(effects);
+        }, batch.size());
+
+        runner.run("PolicyEngine::evaluate_batch" + suffix, 20, [&](std::size_t) {
+            pooled.evaluate_batch(batch.data(), batch.size(), results.data());
+            do_not_optimize(results);
+        }, batch.size());
+
+        if (threads < cores && threads * 2 > cores) threads = cores / 2;
+    }
+
+    // ── Cache sharding ───────────────────────────────────────────────────────
+    // All-hit decide_batch through a cache with one lock versus one shard per
+    // core. Scaling only shows with several cores.
+    runner.section("Decision cache under concurrency, 10000 requests, 864 keys");
+
+    const auto wide = wide_request_mix();
+    std::vector<RequestContext> wide_batch;
+    wide_batch.reserve(10000);
+    for (std::size_t i = 0; i < 10000; ++i) wide_batch.push_back(wide[(i * 31) % wide.size()]);
+
+    for (std::size_t threads = 1; threads <= cores; threads *= 2) {
+        const std::string suffix = " x" + std::to_string(threads) + " threads";
+        for (std::size_t shards : { std::size_t(1), DecisionCache::kShardPerCore }) {
+            auto cached_pool = engine;
+            cached_pool.enable_cache(4096, shards);
+            cached_pool.set_concurrency(threads);
+            const std::string name = shards == 1 ? "decide_batch (cache, 1 lock)"
+                                                 : "decide_batch (cache, per-core shards)";
+            runner.run(name + suffix, 50, [&](std::size_t) {
+                cached_pool.decide_batch(wide_batch.data(), wide_batch.size(), effects.data());
+                do_not_optimize(effects);
+            }, wide_batch.size());
+        }
+        if (threads < cores && threads * 2 > cores) threads = cores / 2;
+    }
+}
+
+} // namespace governance::bench
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "governance/types.hpp"
+
+#include <optional>
+
+namespace governance::builtin {
+
+// The built-in policies as plain callable types. Their bodies are visible to
+// the compiler, so StaticPolicyEngine can inline a whole chain of them; the
+// Policy factories in policy_engine.hpp wrap the same types for PolicyEngine.
+//
+// A static policy type provides name/version/author/description and the
+// attributes it reads as static members, and a const call operator taking a
+// RequestContext and returning std::optional<PolicyDecision>, or
+// std::optional<DecisionView> when its names and reasons are string literals.
+// The built-ins do the latter, so a firing built-in allocates nothing. It may
+// also provide a static applicability() returning its Applicability
+// preconditions.
+
+struct AdminFullAccess {
+    static constexpr const char*  name        = "AdminFullAccess";
+    static constexpr const char*  version     = "1.0";
+    static constexpr const char*  author      = "governance-team";
+    static constexpr const char*  description =
+        "Grants unrestricted access to all principals with the admin role.";
+    static constexpr AttributeSet reads { Attribute::Role };
+
+    static Applicability applicability() {
+        Applicability a;
+        a.roles = { symbols::role_admin };
+        return a;
+    }
+
+    std::optional<DecisionView> operator()(const RequestContext& ctx) const {
+        if (ctx.principal.role == symbols::role_admin) {
+            return DecisionView{ Effect::Allow, name,
+                "Admin role has unrestricted access." };
+        }
+        return std::nullopt;
+    }
+};
+
+struct MFARequiredForRestricted {
+    static constexpr const char*  name        = "MFARequiredForRestricted";
+    static constexpr const char*  version     = "1.0";
+    static constexpr const char*  author      = "governance-team";
+    static constexpr const char*  description =
+        "Denies access to restricted resources when MFA has not been verified.";
+    static constexpr AttributeSet reads { Attribute::Classification, Attribute::Mfa };
+
+    static Applicability applicability() {
+        Applicability a;
+        a.classifications = { symbols::class_restricted };
+        return a;
+    }
+
+    std::optional<DecisionView> operator()(const RequestContext& ctx) const {
+        if (ctx.resource.classification == symbols::class_restricted && !ctx.mfa_verified) {
+            return DecisionView{ Effect::Deny, name,
+                "MFA required to access restricted resources." };
+        }
+        return std::nullopt;
+    }
+};
+
+struct ProductionImmutability {
+    static constexpr const char*  name        = "ProductionImmutability";
+    static constexpr const char*  version     = "1.0";
+    static constexpr const char*  author      = "governance-team";
+    static constexpr const char*  description =
+        "Prevents non-admin principals from writing or deleting in production.";
+    static constexpr AttributeSet reads { Attribute::Environment, Attribute::Role, Attribute::Verb };
+
+    static Applicability applicability() {
+        Applicability a;
+        a.verbs        = { symbols::verb_write, symbols::verb_delete };
+        a.environments = { symbols::env_production };
+        return a;
+    }
+
+    std::optional<DecisionView> operator()(const RequestContext& ctx) const {
+        if (ctx.environment == symbols::env_production &&
+            ctx.principal.role != symbols::role_admin &&
+            (ctx.action.verb == symbols::verb_write || ctx.action.verb == symbols::verb_delete)) {
+            return DecisionView{ Effect::Deny, name,
+                "Write/delete operations require admin role in production." };
+        }
+        return std::nullopt;
+    }
+};
+
+struct AnalystReadOnly {
+    static constexpr const char*  name        = "AnalystReadOnly";
+    static constexpr const char*  version     = "1.0";
+    static constexpr const char*  author      = "governance-team";
+    static constexpr const char*  description =
+        "Restricts analysts to read-only access on non-sensitive resources.";
+    static constexpr AttributeSet reads { Attribute::Role, Attribute::Verb, Attribute::Classification };
+
+    static Applicability applicability() {
+        Applicability a;
+        a.roles = { symbols::role_analyst };
+        return a;
+    }
+
+    std::optional<DecisionView> operator()(const RequestContext& ctx) const {
+        if (ctx.principal.role != symbols::role_analyst) return std::nullopt;
+
+        if (ctx.action.verb != symbols::verb_read) {
+            return DecisionView{ Effect::Deny, name,
+                "Analysts are limited to read-only access." };
+        }
+        if (ctx.resource.classification == symbols::class_restricted ||
+            ctx.resource.classification == symbols::class_confidential) {
+            return DecisionView{ Effect::Deny, name,
+                "Analysts cannot access confidential or restricted data." };
+        }
+        return DecisionView{ Effect::Allow, name,
+            "Analyst read access on non-sensitive resource allowed." };
+    }
+};
+
+struct EngineerAccess {
+    static constexpr const char*  name        = "EngineerAccess";
+    static constexpr const char*  version     = "1.0";
+    static constexpr const char*  author      = "governance-team";
+    static constexpr const char*  description =
+        "Grants engineers full access in dev/staging and read-only in production.";
+    static constexpr AttributeSet reads {
+        Attribute::Role, Attribute::Classification, Attribute::Environment, Attribute::Verb };
+
+    static Applicability applicability() {
+        Applicability a;
+        a.roles = { symbols::role_engineer };
+        return a;
+    }
+
+    std::optional<DecisionView> operator()(const RequestContext& ctx) const {
+        if (ctx.principal.role != symbols::role_engineer) return std::nullopt;
+
+        // Defer restricted resources to other policies (e.g. MFA check)
+        if (ctx.resource.classification == symbols::class_restricted) return std::nullopt;
+
+        if (ctx.environment == symbols::env_dev || ctx.environment == symbols::env_staging) {
+            return DecisionView{ Effect::Allow, name,
+                "Engineers have full access in non-production environments." };
+        }
+        if (ctx.environment == symbols::env_production && ctx.action.verb == symbols::verb_read) {
+            return DecisionView{ Effect::Allow, name,
+                "Engineers can read production resources." };
+        }
+        return std::nullopt;
+    }
+};
+
+} // namespace governance::builtin
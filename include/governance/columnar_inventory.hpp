@@ -0,0 +1,98 @@
+#pragma once
+
+#include "governance/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace governance {
+
+// ── ColumnarInventory ─────────────────────────────────────────────────────────
+
+/**
+ * ColumnarInventory
+ *
+ * A resource inventory stored column by column, for whole-inventory
+ * compliance passes. Type and classification are columns of Symbol ids (the
+ * symbol table is their dictionary), and each tag key has a presence bitmap
+ * plus its values for the rows that carry it. A rule kernel therefore reads
+ * a few dense integer arrays instead of chasing strings and hash maps per
+ * resource, and the compiler can vectorize its compares.
+ *
+ * Rows are grouped in 64-row words. The columns are padded with the empty
+ * Symbol to a whole number of words, so kernels may process the last word in
+ * full; bits for rows at or past size() are ignored by the caller.
+ */
+class ColumnarInventory {
+public:
+    static constexpr std::size_t kRowsPerWord = 64;
+
+    ColumnarInventory() = default;
+    explicit ColumnarInventory(const std::vector<Resource>& resources);
+
+    void append(const Resource& resource);
+    void reserve(std::size_t rows);
+
+    std::size_t size() const { return ids_.size(); }
+    std::size_t words() const { return (size() + kRowsPerWord - 1) / kRowsPerWord; }
+
+    const std::string& id(std::size_t row) const { return ids_[row]; }
+
+    /// Symbol ids, words() * kRowsPerWord entries.
+    const std::uint32_t* types() const { return types_.data(); }
+    const std::uint32_t* classifications() const { return classifications_.data(); }
+
+    /// Presence bitmap of tag `key`, words() entries: bit r % 64 of word
+    /// r / 64 is set if row r has the tag. nullptr if no row has it.
+    const std::uint64_t* tag_bitmap(std::string_view key) const;
+
+    /// Rebuilds row `row` as a Resource, for rules without a column kernel.
+    Resource row(std::size_t row) const;
+
+private:
+    struct TagColumn {
+        std::string                                        key;
+        std::vector<std::uint64_t>                         present;
+        std::vector<std::pair<std::size_t, std::string>>   values;   // by ascending row
+    };
+
+    std::vector<std::string>                     ids_;
+    std::vector<std::uint32_t>                   types_;
+    std::vector<std::uint32_t>                   classifications_;
+    std::vector<TagColumn>                       tags_;
+    std::unordered_map<std::string, std::size_t> tag_index_;
+};
+
+/**
+ * Calls `pred(row)` for every row of words [first_word, last_word) and packs
+ * the results into `out`, one bit per row, out[0] holding first_word. The
+ * predicate is evaluated into a byte per row by a fixed-length, branch-free
+ * loop, which the compiler turns into vector compares when `pred` only
+ * compares column entries; the bytes are then packed eight at a time with a
+ * multiply.
+ */
+template <typename Pred>
+void pack_rows(std::size_t first_word, std::size_t last_word, std::uint64_t* out, Pred pred) {
+    constexpr std::size_t kRows = ColumnarInventory::kRowsPerWord;
+    for (std::size_t w = first_word; w < last_word; ++w) {
+        std::uint8_t flags[kRows];
+        for (std::size_t b = 0; b < kRows; ++b) flags[b] = pred(w * kRows + b) ? 1 : 0;
+
+        std::uint64_t bits = 0;
+        for (std::size_t group = 0; group < kRows / 8; ++group) {
+            std::uint64_t lanes = 0;   // flag i in byte i
+            for (std::size_t i = 0; i < 8; ++i)
+                lanes |= static_cast<std::uint64_t>(flags[group * 8 + i]) << (8 * i);
+            // Gathers bit 0 of each byte into the top byte, byte i to bit i.
+            bits |= (lanes * 0x0102040810204080u >> 56) << (group * 8);
+        }
+        out[w - first_word] = bits;
+    }
+}
+
+} // namespace governance
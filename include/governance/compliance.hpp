@@ -1,27 +1,94 @@
 #pragma once
 
 #include "governance/types.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iosfwd>
+#include <memory>
+#include <optional>
 #include <vector>
 #include <string>
 
 namespace governance {
 
+class ColumnarInventory;
+class InventorySnapshot;
+class ThreadPool;
+
+/// Columnar form of a rule's check, used by summarize(const ColumnarInventory&):
+/// sets bit r % 64 of failed[r / 64 - first_word] for every row r in words
+/// [first_word, last_word) that fails the rule, and clears the other bits.
+using ColumnKernel = std::function<void(const ColumnarInventory& inventory, std::size_t first_word,
+                                        std::size_t last_word, std::uint64_t* failed)>;
+
 struct ComplianceRule {
     std::string name;
     std::string version;
     std::string author;
     std::string description;
     std::function<bool(const Resource&)> check;
+    std::uint32_t cost = 1;   // relative cost of check, used by order_rules()
+    ColumnKernel  column_check = nullptr;   // optional; must agree with check
+
+    /// Resource fields `check` reads (ResourceId, ResourceType,
+    /// Classification, Tags), used by IncrementalComplianceChecker to re-run
+    /// only the rules a change can affect. The default (everything) is always
+    /// correct. With Tags, a non-empty `tag_keys` narrows the dependency to
+    /// those keys; empty means any tag.
+    AttributeSet             reads = AttributeSet::all();
+    std::vector<std::string> tag_keys = {};
+};
+
+/**
+ * Violation
+ *
+ * One failed rule in a ComplianceReport: the rule's index in its checker and
+ * its interned name and description. Recording one copies three integers;
+ * the "[name] description" text is built only when str() or operator<< asks
+ * for it. The Symbols keep the text alive, so a Violation stays printable
+ * after its checker is gone.
+ */
+struct Violation {
+    std::uint32_t rule = 0;   // index in the checker's rules, in add_rule() order
+    Symbol        name;
+    Symbol        description;
+
+    std::string str() const;
+
+    friend bool operator==(const Violation& a, const Violation& b) {
+        return a.rule == b.rule && a.name == b.name && a.description == b.description;
+    }
+    friend bool operator!=(const Violation& a, const Violation& b) { return !(a == b); }
 };
 
+std::ostream& operator<<(std::ostream& os, const Violation& violation);
+
 struct ComplianceReport {
-    std::string              resource_id;
-    std::vector<std::string> violations;
+    std::string            resource_id;
+    std::vector<Violation> violations;
 
     bool compliant() const { return violations.empty(); }
 };
 
+/// Violations of one rule across a summarize() run.
+struct RuleSummary {
+    std::string   rule_name;
+    std::uint64_t violations = 0;
+};
+
+/// Aggregate outcome of ComplianceChecker::summarize().
+struct ComplianceSummary {
+    std::uint64_t            resources = 0;
+    std::vector<RuleSummary> rules;           // registration order
+    std::vector<std::string> non_compliant;   // resource ids, input order
+
+    std::uint64_t compliant_count() const { return resources - non_compliant.size(); }
+};
+
+/// Receives scan() results: the resource's index in the input and its report.
+using ReportSink = std::function<void(std::size_t index, ComplianceReport&& report)>;
+
 /**
  * ComplianceChecker
  *
@@ -34,10 +101,97 @@ public:
 
     ComplianceReport evaluate(const Resource& resource) const;
 
+    // ── Early exit ───────────────────────────────────────────────────────────
+    //
+    // For callers that need less than a full report, e.g. a deployment gate.
+    // is_compliant() and first_violation() stop at the first failing rule,
+    // trying rules in rule_order(); count_violations() checks every rule but
+    // builds nothing.
+
+    bool is_compliant(const Resource& resource) const;
+
+    /// The first failure in rule_order(), or nullopt if the resource is
+    /// compliant. Which violation is reported depends on the order.
+    std::optional<Violation> first_violation(const Resource& resource) const;
+
+    std::size_t count_violations(const Resource& resource) const;
+
+    /// Orders rules by ascending ComplianceRule::cost, so cheap checks run
+    /// before expensive ones.
+    void order_rules();
+
+    /// Orders rules so the early exit is expected to come soonest: by cost
+    /// divided by the failure rate observed in `observed`, a summarize() run
+    /// over a representative inventory. Rules that never failed go last, by
+    /// cost. Throws std::invalid_argument if `observed` does not list this
+    /// checker's rules.
+    void order_rules(const ComplianceSummary& observed);
+
+    /// Rule indices in the order the early-exit modes try them; registration
+    /// order until order_rules() is called. evaluate() always reports
+    /// violations in registration order.
+    const std::vector<std::uint32_t>& rule_order() const { return order_; }
+
+    /// Evaluates `count` resources into `reports[0..count)`, fanning the work
+    /// out over the checker's thread pool (see set_concurrency()). Each report
+    /// equals evaluate(resources[i]).
+    void scan(const Resource* resources, std::size_t count, ComplianceReport* reports) const;
+    std::vector<ComplianceReport> scan(const std::vector<Resource>& resources) const;
+
+    /// Streaming form for scans too large to hold every report: resources
+    /// are evaluated in windows of kScanWindow per thread, and `sink` is
+    /// called for each report in input order, on the calling thread, never
+    /// concurrently. Memory stays bounded by the window however long the scan.
+    void scan(const Resource* resources, std::size_t count, const ReportSink& sink) const;
+    void scan(const std::vector<Resource>& resources, const ReportSink& sink) const;
+
+    /// Streaming scan of a mapped snapshot: each thread decodes its records
+    /// into a Resource it reuses, so nothing is deserialized ahead of the
+    /// scan and pages are touched only as it reaches them.
+    void scan(const InventorySnapshot& snapshot, const ReportSink& sink) const;
+
+    static constexpr std::size_t kScanWindow = 4096;
+
+    /// Per-rule violation counts and the ids of non-compliant resources,
+    /// without building reports or formatting violation strings. Threads
+    /// count into their own accumulators, merged once at the end, so memory
+    /// is O(rules + non-compliant resources).
+    ComplianceSummary summarize(const Resource* resources, std::size_t count) const;
+    ComplianceSummary summarize(const std::vector<Resource>& resources) const;
+
+    /// The same summary over a columnar inventory. Rules with a column_check
+    /// run it over blocks of whole words; rules without one fall back to
+    /// check() on rows rebuilt from the columns, which is correct but slow.
+    ComplianceSummary summarize(const ColumnarInventory& inventory) const;
+
+    /// The same summary over a mapped snapshot, decoding records as above.
+    ComplianceSummary summarize(const InventorySnapshot& snapshot) const;
+
+    /// Number of threads (including the caller) used by scan() and
+    /// summarize(). 1, the default, scans on the calling thread; 0 selects
+    /// std::thread::hardware_concurrency(). Copies share the pool.
+    void        set_concurrency(std::size_t threads);
+    std::size_t concurrency() const;
+
     std::size_t rule_count() const { return rules_.size(); }
 
+    /// The rules in registration order, and the Violation each records.
+    const std::vector<ComplianceRule>& rules() const { return rules_; }
+    const Violation& violation(std::size_t rule) const { return violations_[rule]; }
+
 private:
+    template <typename Fn>
+    void for_each_chunk(std::size_t count, Fn&& fn) const;
+
+    // summarize() over rows produced by row(i, scratch), which returns the
+    // i-th Resource, decoding into the thread's scratch if it needs to.
+    template <typename Row, typename Id>
+    ComplianceSummary summarize_rows(std::size_t count, Row&& row, Id&& id) const;
+
     std::vector<ComplianceRule> rules_;
+    std::vector<Violation>      violations_;   // per rule, recorded as-is on failure
+    std::vector<std::uint32_t>  order_;        // see rule_order()
+    std::shared_ptr<ThreadPool> pool_;
 };
 
 // ── Built-in compliance rules ─────────────────────────────────────────────
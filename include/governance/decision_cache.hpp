@@ -0,0 +1,137 @@
+#pragma once
+
+#include "governance/policy_engine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace governance {
+
+/**
+ * DecisionKey
+ *
+ * A RequestContext projected onto the attributes the registered policies
+ * declare they read. Attributes outside that set are left zero, so requests
+ * that differ only in fields no policy looks at share one cache entry.
+ */
+struct DecisionKey {
+    std::uint32_t role           = 0;
+    std::uint32_t resource_type  = 0;
+    std::uint32_t classification = 0;
+    std::uint32_t verb           = 0;
+    std::uint32_t environment    = 0;
+    bool          mfa_verified   = false;
+
+    static DecisionKey from(const RequestContext& ctx, AttributeSet attrs);
+
+    friend bool operator==(const DecisionKey& a, const DecisionKey& b) {
+        return a.role == b.role && a.resource_type == b.resource_type &&
+               a.classification == b.classification && a.verb == b.verb &&
+               a.environment == b.environment && a.mfa_verified == b.mfa_verified;
+    }
+};
+
+struct DecisionKeyHash {
+    std::size_t operator()(const DecisionKey& k) const noexcept;
+};
+
+/// What the cache remembers for a key: the decision and the trace steps that
+/// produced it. The trace context is rebuilt from the live request on a hit.
+struct CachedDecision {
+    PolicyDecision          decision;
+    std::vector<PolicyStep> steps;
+};
+
+/**
+ * DecisionCache
+ *
+ * A bounded, thread-safe map from DecisionKey to CachedDecision, split by
+ * key hash into independently locked shards so threads looking up
+ * different keys rarely contend. Each shard evicts with the CLOCK
+ * algorithm: a hit only sets a reference bit, and the clock hand skips (and
+ * clears) referenced slots when looking for a victim.
+ */
+class DecisionCache {
+public:
+    /// Passed as `shards`: one shard per hardware thread.
+    static constexpr std::size_t kShardPerCore = 0;
+
+    /// `capacity` is split evenly over the shards. The shard count is
+    /// rounded down to a power of two and reduced so that every shard holds
+    /// at least kMinShardCapacity entries; 1 gives a single global lock.
+    explicit DecisionCache(std::size_t capacity, std::size_t shards = 1);
+
+    static constexpr std::size_t kMinShardCapacity = 16;
+
+    /// Copies the cached entry for `key` into `out`. Counts a hit or a miss.
+    bool lookup(const DecisionKey& key, CachedDecision& out);
+
+    /// Calls fn(const CachedDecision&) on the entry for `key` while its shard
+    /// is locked, without copying it. Counts a hit or a miss.
+    template <typename Fn>
+    bool visit(const DecisionKey& key, Fn&& fn) {
+        Shard& shard = shard_for(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const Slot* slot = shard.find(key);
+        if (!slot) return false;
+        fn(slot->value);
+        return true;
+    }
+
+    /// Effect-only lookup for PolicyEngine::decide(); copies nothing.
+    std::optional<Effect> lookup_effect(const DecisionKey& key);
+
+    void insert(const DecisionKey& key, CachedDecision value);
+
+    /// An empty cache with the same shape that carries the cumulative
+    /// counters forward and records one invalidation. The engine swaps this
+    /// in whenever its policy set changes.
+    std::shared_ptr<DecisionCache> invalidated() const;
+
+    /// Summed over the shards.
+    CacheStats  stats() const;
+    std::size_t capacity() const { return shard_capacity_ * shard_count_; }
+    std::size_t shard_count() const { return shard_count_; }
+
+private:
+    struct Slot {
+        DecisionKey    key;
+        CachedDecision value;
+        bool           referenced = false;
+    };
+
+    // Padded so neighbouring shards' locks do not share a cache line.
+    struct alignas(64) Shard {
+        void reserve(std::size_t capacity);
+
+        // Caller holds mutex.
+        const Slot* find(const DecisionKey& key);
+        void        insert(const DecisionKey& key, CachedDecision value);
+
+        mutable std::mutex                                            mutex;
+        std::vector<Slot>                                             slots;
+        std::unordered_map<DecisionKey, std::size_t, DecisionKeyHash> index;
+        std::size_t                                                   used = 0;
+        std::size_t                                                   hand = 0;
+        CacheStats                                                    stats;
+    };
+
+    Shard& shard_for(const DecisionKey& key) const {
+        // Fibonacci hashing takes the top bits, independent of the bits the
+        // shard's own hash table uses.
+        const std::uint64_t h = static_cast<std::uint64_t>(DecisionKeyHash{}(key)) * 0x9e3779b97f4a7c15ull;
+        return shards_[shard_count_ == 1 ? 0 : static_cast<std::size_t>(h >> (64 - shard_bits_))];
+    }
+
+    std::size_t              shard_count_    = 1;
+    unsigned                 shard_bits_     = 0;
+    std::size_t              shard_capacity_ = 1;
+    std::unique_ptr<Shard[]> shards_;
+};
+
+} // namespace governance
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "governance/policy_engine.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace governance {
+
+/**
+ * DecisionTable
+ *
+ * A PolicyEngine compiled into a dense lookup table. compile() enumerates
+ * every combination of the attributes the engine's policies read (role,
+ * resource type, classification, verb, environment, mfa_verified), runs the
+ * policy chain once per cell and stores the resulting decision. decide() is
+ * then a handful of array lookups regardless of how many policies there are.
+ *
+ * Requests carrying a value outside the compiled domain (e.g. an unknown
+ * role) fall back to the interpreted engine, so results are always identical
+ * to PolicyEngine::decide(). Traced evaluation always uses the engine.
+ *
+ * Only engines whose policies are all cacheable can be compiled: a policy
+ * that reads ids, department or tags cannot be tabulated. The table keeps
+ * its own copy of the engine without a decision cache, so compiling never
+ * touches the caller's cache and out-of-domain requests are interpreted.
+ */
+class DecisionTable {
+public:
+    /// Attribute values to enumerate, one list per dimension.
+    struct Domain {
+        std::vector<Symbol> roles;
+        std::vector<Symbol> resource_types;
+        std::vector<Symbol> classifications;
+        std::vector<Symbol> verbs;
+        std::vector<Symbol> environments;
+
+        /// The built-in vocabulary from governance::symbols.
+        static Domain well_known();
+    };
+
+    /// Throws std::invalid_argument if `engine` is not cacheable or a read
+    /// dimension has an empty domain.
+    static DecisionTable compile(PolicyEngine engine, Domain domain = Domain::well_known());
+
+    Effect           decide(const RequestContext& ctx) const;
+    PolicyDecision   decision(const RequestContext& ctx) const;
+    EvaluationResult evaluate(const RequestContext& ctx) const { return engine_.evaluate(ctx); }
+
+    /// True when decide() is answered from the table rather than the engine.
+    bool in_domain(const RequestContext& ctx) const { return cell_of(ctx).has_value(); }
+
+    /// Re-runs the interpreted engine on every cell and returns the number of
+    /// cells whose stored decision differs. 0 means the table is exact.
+    std::size_t verify() const;
+
+    std::size_t         cell_count() const { return effects_.size(); }
+    const PolicyEngine& engine() const { return engine_; }
+
+private:
+    enum Dim : std::size_t { Role, ResourceType, Classification, Verb, Environment, Mfa, DimCount };
+
+    struct Dimension {
+        std::vector<Symbol>       values;     // coordinate -> value
+        std::vector<std::uint8_t> index_of;   // symbol id -> coordinate, kAbsent if not in domain
+        std::size_t               size   = 1;
+        std::size_t               stride = 0; // 0 when the engine does not read this dimension
+    };
+
+    static constexpr std::uint8_t kAbsent = 0xFF;
+
+    DecisionTable() = default;
+
+    static std::uint32_t coordinate_id(const RequestContext& ctx, std::size_t dim);
+    static void          set_coordinate(RequestContext& ctx, std::size_t dim, Symbol value);
+
+    std::optional<std::size_t> cell_of(const RequestContext& ctx) const;
+    RequestContext             context_for(std::size_t cell) const;
+
+    PolicyEngine                        engine_;
+    std::array<Dimension, DimCount>     dims_;
+    std::vector<Effect>                 effects_;     // per cell
+    std::vector<std::uint16_t>          decision_of_; // per cell, index into decisions_
+    std::vector<PolicyDecision>         decisions_;   // distinct decisions
+};
+
+} // namespace governance
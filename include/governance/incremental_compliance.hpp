@@ -0,0 +1,96 @@
+#pragma once
+
+#include "governance/compliance.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace governance {
+
+/**
+ * A change to one resource, as delivered by a change feed. Unset fields are
+ * unchanged; each tag entry sets the key to a value, or removes it if the
+ * value is nullopt.
+ */
+struct ResourceDelta {
+    std::string           id;
+    std::optional<Symbol> type;
+    std::optional<Symbol> classification;
+    std::vector<std::pair<Symbol, std::optional<std::string>>> tags;
+
+    /// The delta that turns `before` into `after` (which share an id).
+    static ResourceDelta between(const Resource& before, const Resource& after);
+};
+
+/**
+ * IncrementalComplianceChecker
+ *
+ * Keeps every tracked resource with its current ComplianceReport, and on a
+ * change re-runs only the rules that read a changed field, as declared in
+ * ComplianceRule::reads and tag_keys. A delta that touches one tag costs
+ * the rules reading that tag instead of every rule; a delta that sets a
+ * field to its current value costs nothing.
+ *
+ * Reports are kept equal to ComplianceChecker::evaluate() on the current
+ * resource, provided every rule's declared reads are accurate. Not
+ * thread-safe; feed it from one thread.
+ */
+class IncrementalComplianceChecker {
+public:
+    explicit IncrementalComplianceChecker(ComplianceChecker checker);
+
+    /// Starts tracking `resource`, or replaces the tracked resource with the
+    /// same id; a replacement re-runs only the rules its changes affect.
+    const ComplianceReport& upsert(const Resource& resource);
+
+    /// Applies `delta` to the tracked resource and updates its report.
+    /// Throws std::out_of_range if the id is not tracked.
+    const ComplianceReport& apply(const ResourceDelta& delta);
+
+    /// Stops tracking `id`. Returns false if it was not tracked.
+    bool erase(const std::string& id);
+
+    /// The tracked resource and its report, or nullptr.
+    const Resource*         resource(const std::string& id) const;
+    const ComplianceReport* report(const std::string& id) const;
+
+    std::size_t size() const { return entries_.size(); }
+
+    /// Rule checks run so far, full evaluations included.
+    std::uint64_t rule_evaluations() const { return rule_evaluations_; }
+
+    const ComplianceChecker& checker() const { return checker_; }
+
+private:
+    struct Entry {
+        Resource         resource;
+        ComplianceReport report;   // violations sorted by rule index
+    };
+
+    void mark(const std::vector<std::uint32_t>& rules);
+    void mark_tag(Symbol key);
+    void rerun_marked(Entry& entry);
+
+    ComplianceChecker                      checker_;
+    std::unordered_map<std::string, Entry> entries_;
+
+    // Rules by the fields they read.
+    std::vector<std::uint32_t> type_rules_;
+    std::vector<std::uint32_t> classification_rules_;
+    std::vector<std::uint32_t> any_tag_rules_;
+    std::unordered_map<Symbol, std::vector<std::uint32_t>> tag_rules_;
+
+    // Rules to re-run for the current change, deduplicated by stamp.
+    std::vector<std::uint32_t> marked_;
+    std::vector<std::uint64_t> stamps_;
+    std::uint64_t              stamp_ = 0;
+
+    std::uint64_t rule_evaluations_ = 0;
+};
+
+} // namespace governance
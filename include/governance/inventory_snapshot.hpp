@@ -0,0 +1,185 @@
+#pragma once
+
+// Binary inventory snapshots: a Resource collection laid out so a process can
+// map the file and scan it in place, instead of parsing an export at startup.
+//
+// A snapshot is one file in the writer's native byte order (the magic number
+// doubles as the byte-order check), made of sections at 8-byte aligned
+// offsets recorded in the header:
+//
+//   Header       magic, version, counts, section offsets, file size
+//   vocabulary   snapshot::String[vocabulary_count]; entry 0 is ""
+//   records      snapshot::Record[resource_count], fixed width
+//   tags         snapshot::Tag[tag_count]; each record's tags are contiguous
+//   strings      the bytes of every vocabulary entry, id and tag value
+//
+// Types, classifications and tag keys are indices into the vocabulary, which
+// is interned once when the snapshot is opened; ids and tag values are
+// read straight from the strings section. Strings are limited to 4 GiB in
+// total, tags to 2^32 and the vocabulary to snapshot::kMaxVocabulary entries
+// per snapshot.
+
+#include "governance/resource_reader.hpp"
+#include "governance/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace governance {
+
+// ── Format ────────────────────────────────────────────────────────────────────
+
+namespace snapshot {
+
+inline constexpr std::uint64_t kMagic   = 0x3150414e53564f47ull;   // "GOVSNAP1"
+inline constexpr std::uint32_t kVersion = 1;
+
+// Opening a snapshot interns its whole vocabulary, and the symbol table never
+// shrinks, so a file may add no more symbols than a ResourceReader may.
+inline constexpr std::uint32_t kMaxVocabulary = ResourceReader::kMaxSymbols;
+
+struct Header {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t vocabulary_count;
+    std::uint64_t resource_count;
+    std::uint64_t tag_count;
+    std::uint64_t vocabulary_offset;
+    std::uint64_t records_offset;
+    std::uint64_t tags_offset;
+    std::uint64_t strings_offset;
+    std::uint64_t strings_size;
+    std::uint64_t file_size;
+};
+
+/// A byte range of the strings section.
+struct String {
+    std::uint32_t offset;
+    std::uint32_t size;
+};
+
+struct Record {
+    String        id;
+    std::uint32_t type;             // vocabulary index
+    std::uint32_t classification;   // vocabulary index
+    std::uint32_t tags_begin;       // index of the record's first Tag
+    std::uint32_t tags_size;
+};
+
+struct Tag {
+    std::uint32_t key;              // vocabulary index
+    String        value;
+};
+
+} // namespace snapshot
+
+// ── InventorySnapshot ─────────────────────────────────────────────────────────
+
+/**
+ * InventorySnapshot
+ *
+ * A read-only view of a snapshot file. open() maps the file and checks only
+ * the header and the vocabulary, so it costs the same for ten resources or
+ * ten million; pages of records, tags and strings are faulted in by the OS
+ * as a scan reaches them. read() checks each reference it follows, so a
+ * corrupt file raises an exception rather than reading out of bounds, and
+ * validate() runs those checks over the whole file up front.
+ *
+ * ComplianceChecker::summarize() and scan() take a snapshot directly: each
+ * thread decodes records into a Resource it reuses, so a scan allocates
+ * nothing per resource once warm.
+ */
+class InventorySnapshot {
+public:
+    /// Maps the snapshot at `path` read-only. Throws std::system_error if
+    /// the file cannot be opened or mapped, std::invalid_argument if it is
+    /// not a valid snapshot.
+    static InventorySnapshot open(const std::string& path);
+
+    /// A snapshot over caller-owned memory, which must stay valid and be
+    /// 8-byte aligned. Throws std::invalid_argument like open().
+    static InventorySnapshot view(const void* data, std::size_t size);
+
+    InventorySnapshot(InventorySnapshot&& other) noexcept;
+    InventorySnapshot& operator=(InventorySnapshot&& other) noexcept;
+    ~InventorySnapshot();
+
+    std::size_t size() const { return resource_count_; }
+    std::size_t tag_count() const { return tag_count_; }
+    std::size_t file_size() const { return size_; }
+
+    /// The vocabulary, interned: vocabulary()[0] is the empty Symbol.
+    const std::vector<Symbol>& vocabulary() const { return vocabulary_; }
+
+    /// The id of resource `i`, viewing the mapped file.
+    std::string_view id(std::size_t i) const;
+
+    /// Decodes resource `i` into `out`, reusing its storage. Throws
+    /// std::invalid_argument if the record refers outside the snapshot.
+    void     read(std::size_t i, Resource& out) const;
+    Resource read(std::size_t i) const;
+
+    /// Checks every record, tag and string reference, reading the whole
+    /// file. Throws std::invalid_argument naming the first bad record.
+    void validate() const;
+
+private:
+    InventorySnapshot() = default;
+
+    void             attach(const void* data, std::size_t size);
+    std::string_view string(const snapshot::String& s, std::size_t record) const;
+    Symbol           word(std::uint32_t index, std::size_t record) const;
+
+    const std::uint8_t*     base_    = nullptr;
+    std::size_t             size_    = 0;
+    void*                   mapping_ = nullptr;   // set by open(); released on destruction
+    const snapshot::Record* records_ = nullptr;
+    const snapshot::Tag*    tags_    = nullptr;
+    const char*             strings_ = nullptr;
+    std::size_t             resource_count_ = 0;
+    std::size_t             tag_count_      = 0;
+    std::size_t             strings_size_   = 0;
+    std::vector<Symbol>     vocabulary_;
+};
+
+// ── SnapshotWriter ────────────────────────────────────────────────────────────
+
+/**
+ * SnapshotWriter
+ *
+ * Builds a snapshot from Resources. add() packs each resource into the
+ * records, tags and strings the file will hold, so memory grows with the
+ * size of the output, not with the Resources added; write() then emits the
+ * sections in one pass.
+ */
+class SnapshotWriter {
+public:
+    SnapshotWriter();
+
+    /// Throws std::length_error past the format's 4 GiB of strings, 2^32
+    /// tags or snapshot::kMaxVocabulary vocabulary entries.
+    void add(const Resource& resource);
+
+    std::size_t size() const { return records_.size(); }
+
+    /// Writes the snapshot to `out`. Throws std::runtime_error if the stream
+    /// fails.
+    void write(std::ostream& out) const;
+
+private:
+    std::uint32_t    word(Symbol symbol);
+    snapshot::String string(std::string_view text);
+
+    std::vector<snapshot::String>             vocabulary_;
+    std::unordered_map<Symbol, std::uint32_t> vocabulary_index_;
+    std::vector<snapshot::Record>             records_;
+    std::vector<snapshot::Tag>                tags_;
+    std::string                               strings_;
+};
+
+} // namespace governance
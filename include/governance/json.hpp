@@ -2,31 +2,66 @@
 
 #include "governance/policy_engine.hpp"
 #include "governance/compliance.hpp"
+#include "governance/trace_arena.hpp"
 
+#include <ostream>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 namespace governance {
 
 namespace json_detail {
 
-inline std::string escape(const std::string& s) {
-    std::string result;
-    result.reserve(s.size());
-    for (char c : s) {
-        switch (c) {
-            case '"':  result += "\\\""; break;
-            case '\\': result += "\\\\"; break;
-            case '\n': result += "\\n";  break;
-            case '\r': result += "\\r";  break;
-            case '\t': result += "\\t";  break;
-            default:   result += c;      break;
+// Calls `append` with the JSON-escaped form of `s`, in pieces: runs of plain
+// characters are passed through without copying.
+template <typename Append>
+void escape_into(std::string_view s, Append&& append) {
+    std::size_t run = 0;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        char hex[7] = "\\u00";
+        std::string_view esc;
+        switch (s[i]) {
+            case '"':  esc = "\\\""; break;
+            case '\\': esc = "\\\\"; break;
+            case '\n': esc = "\\n";  break;
+            case '\r': esc = "\\r";  break;
+            case '\t': esc = "\\t";  break;
+            default: {
+                const auto c = static_cast<unsigned char>(s[i]);
+                if (c >= 0x20) continue;
+                hex[4] = "0123456789abcdef"[c >> 4];
+                hex[5] = "0123456789abcdef"[c & 0xF];
+                esc = { hex, 6 };
+            }
         }
+        append(s.substr(run, i - run));
+        append(esc);
+        run = i + 1;
     }
+    append(s.substr(run));
+}
+
+inline std::string escape(std::string_view s) {
+    std::string result;
+    result.reserve(s.size());
+    escape_into(s, [&](std::string_view piece) { result.append(piece); });
     return result;
 }
 
-inline std::string quoted(const std::string& s) {
+inline void write_escaped(std::ostream& os, std::string_view s) {
+    escape_into(s, [&](std::string_view piece) {
+        os.write(piece.data(), static_cast<std::streamsize>(piece.size()));
+    });
+}
+
+inline void write_quoted(std::ostream& os, std::string_view s) {
+    os.put('"');
+    write_escaped(os, s);
+    os.put('"');
+}
+
+inline std::string quoted(std::string_view s) {
     return "\"" + escape(s) + "\"";
 }
 
@@ -43,6 +78,43 @@ inline std::string outcome_str(StepOutcome o) {
     }
 }
 
+template <typename Step>
+std::string step_json(const Step& step) {
+    std::ostringstream os;
+    os << "{ \"policy\": "  << quoted(step.policy_name)
+       << ", \"outcome\": " << quoted(outcome_str(step.outcome))
+       << ", \"reason\": "  << quoted(step.reason);
+    if (step.duration_ns) os << ", \"duration_ns\": " << step.duration_ns;   // profiling only
+    os << " }";
+    return os.str();
+}
+
+// Shared by the owning and arena-backed results so both serialize identically.
+template <typename Decision, typename Steps>
+std::string evaluation_json(const Decision& d, const RequestContext& ctx, const Steps& steps) {
+    std::ostringstream os;
+    os << "{\n"
+       << "  \"decision\": {\n"
+       << "    \"effect\": "      << quoted(effect_str(d.effect)) << ",\n"
+       << "    \"policy_name\": " << quoted(d.policy_name) << ",\n"
+       << "    \"reason\": "      << quoted(d.reason) << "\n"
+       << "  },\n"
+       << "  \"trace\": {\n"
+       << "    \"principal\": "   << quoted(ctx.principal.id) << ",\n"
+       << "    \"resource\": "    << quoted(ctx.resource.id) << ",\n"
+       << "    \"action\": "      << quoted(ctx.action.verb.str()) << ",\n"
+       << "    \"environment\": " << quoted(ctx.environment.str()) << ",\n"
+       << "    \"steps\": [";
+    for (std::size_t i = 0; i < steps.size(); ++i) {
+        os << "\n      " << step_json(steps[i]);
+        if (i + 1 < steps.size()) os << ",";
+    }
+    os << "\n    ]\n"
+       << "  }\n"
+       << "}";
+    return os.str();
+}
+
 } // namespace json_detail
 
 inline std::string to_json(const PolicyDecision& d) {
@@ -55,37 +127,56 @@ inline std::string to_json(const PolicyDecision& d) {
     return os.str();
 }
 
-inline std::string to_json(const PolicyStep& step) {
+inline std::string to_json(const PolicyStep& step) { return json_detail::step_json(step); }
+inline std::string to_json(const StepView& step)   { return json_detail::step_json(step); }
+
+inline std::string to_json(const EvaluationResult& result) {
+    return json_detail::evaluation_json(result.decision, result.trace.context, result.trace.steps);
+}
+
+/// Same output as to_json(view.to_result()).
+inline std::string to_json(const EvaluationView& view) {
+    static const RequestContext empty;
+    return json_detail::evaluation_json(view.decision,
+                                        view.trace.context ? *view.trace.context : empty,
+                                        view.trace);
+}
+
+inline std::string to_json(const PolicyCounterSnapshot& snapshot) {
     std::ostringstream os;
-    os << "{ \"policy\": "  << json_detail::quoted(step.policy_name)
-       << ", \"outcome\": " << json_detail::quoted(json_detail::outcome_str(step.outcome))
-       << ", \"reason\": "  << json_detail::quoted(step.reason)
-       << " }";
+    os << "{\n"
+       << "  \"evaluations\": " << snapshot.evaluations << ",\n"
+       << "  \"policies\": [";
+    for (std::size_t i = 0; i < snapshot.policies.size(); ++i) {
+        const auto& p = snapshot.policies[i];
+        os << "\n    { \"policy\": " << json_detail::quoted(p.policy_name)
+           << ", \"allow\": "   << p.allow
+           << ", \"deny\": "    << p.deny
+           << ", \"abstain\": " << p.abstain
+           << ", \"total\": "   << p.total() << " }";
+        if (i + 1 < snapshot.policies.size()) os << ",";
+    }
+    os << "\n  ]\n"
+       << "}";
     return os.str();
 }
 
-inline std::string to_json(const EvaluationResult& result) {
+inline std::string to_json(const PolicyProfile& profile) {
     std::ostringstream os;
-    const auto& d = result.decision;
-    const auto& t = result.trace;
     os << "{\n"
-       << "  \"decision\": {\n"
-       << "    \"effect\": "      << json_detail::quoted(json_detail::effect_str(d.effect)) << ",\n"
-       << "    \"policy_name\": " << json_detail::quoted(d.policy_name) << ",\n"
-       << "    \"reason\": "      << json_detail::quoted(d.reason) << "\n"
-       << "  },\n"
-       << "  \"trace\": {\n"
-       << "    \"principal\": "   << json_detail::quoted(t.context.principal.id) << ",\n"
-       << "    \"resource\": "    << json_detail::quoted(t.context.resource.id) << ",\n"
-       << "    \"action\": "      << json_detail::quoted(t.context.action.verb) << ",\n"
-       << "    \"environment\": " << json_detail::quoted(t.context.environment) << ",\n"
-       << "    \"steps\": [";
-    for (std::size_t i = 0; i < t.steps.size(); ++i) {
-        os << "\n      " << to_json(t.steps[i]);
-        if (i + 1 < t.steps.size()) os << ",";
+       << "  \"policies\": [";
+    for (std::size_t i = 0; i < profile.policies.size(); ++i) {
+        const auto& p = profile.policies[i];
+        os << "\n    { \"policy\": " << json_detail::quoted(p.policy_name)
+           << ", \"count\": "    << p.latency.count()
+           << ", \"mean_ns\": "  << static_cast<std::uint64_t>(p.latency.mean())
+           << ", \"p50_ns\": "   << p.latency.percentile(0.50)
+           << ", \"p99_ns\": "   << p.latency.percentile(0.99)
+           << ", \"p999_ns\": "  << p.latency.percentile(0.999)
+           << ", \"max_ns\": "   << p.latency.max() << " }";
+        if (i + 1 < profile.policies.size()) os << ",";
     }
-    os << "\n    ]\n"
-       << "  }\n"
+    os << "\n  ]\n"
        << "}";
     return os.str();
 }
@@ -97,7 +188,7 @@ inline std::string to_json(const ComplianceReport& report) {
        << "  \"compliant\": "   << (report.compliant() ? "true" : "false") << ",\n"
        << "  \"violations\": [";
     for (std::size_t i = 0; i < report.violations.size(); ++i) {
-        os << "\n    " << json_detail::quoted(report.violations[i]);
+        os << "\n    " << json_detail::quoted(report.violations[i].str());
         if (i + 1 < report.violations.size()) os << ",";
     }
     os << "\n  ]\n"
@@ -105,4 +196,46 @@ inline std::string to_json(const ComplianceReport& report) {
     return os.str();
 }
 
+/// Writes `report` as one compact line of NDJSON, straight to `os`:
+///   {"resource_id":"db-1","compliant":false,"violations":["[Rule] description"]}
+/// Violation text is escaped from the interned name and description without
+/// building the formatted string.
+inline void write_json_line(std::ostream& os, const ComplianceReport& report) {
+    os << "{\"resource_id\":";
+    json_detail::write_quoted(os, report.resource_id);
+    os << ",\"compliant\":" << (report.compliant() ? "true" : "false") << ",\"violations\":[";
+    for (std::size_t i = 0; i < report.violations.size(); ++i) {
+        const Violation& v = report.violations[i];
+        if (i) os.put(',');
+        os << "\"[";
+        json_detail::write_escaped(os, v.name.str());
+        os << "] ";
+        json_detail::write_escaped(os, v.description.str());
+        os.put('"');
+    }
+    os << "]}\n";
+}
+
+inline std::string to_json(const ComplianceSummary& summary) {
+    std::ostringstream os;
+    os << "{\n"
+       << "  \"resources\": " << summary.resources << ",\n"
+       << "  \"compliant\": " << summary.compliant_count() << ",\n"
+       << "  \"rules\": [";
+    for (std::size_t i = 0; i < summary.rules.size(); ++i) {
+        os << "\n    { \"rule\": " << json_detail::quoted(summary.rules[i].rule_name)
+           << ", \"violations\": " << summary.rules[i].violations << " }";
+        if (i + 1 < summary.rules.size()) os << ",";
+    }
+    os << "\n  ],\n"
+       << "  \"non_compliant\": [";
+    for (std::size_t i = 0; i < summary.non_compliant.size(); ++i) {
+        os << "\n    " << json_detail::quoted(summary.non_compliant[i]);
+        if (i + 1 < summary.non_compliant.size()) os << ",";
+    }
+    os << "\n  ]\n"
+       << "}";
+    return os.str();
+}
+
 } // namespace governance
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace governance {
+
+/**
+ * LatencyHistogram
+ *
+ * Log-bucketed histogram of nanosecond durations in the style of HDR
+ * histograms: each power of two is split into kSubBuckets linear buckets,
+ * so any recorded value is reported within 1/kSubBuckets (12.5%) of its
+ * true value, from 1 ns up to about 9 minutes, in a fixed 2.4 KB. Values
+ * beyond the top bucket are clamped into it; max() stays exact.
+ */
+class LatencyHistogram {
+public:
+    static constexpr unsigned    kSubBucketBits = 3;
+    static constexpr std::size_t kSubBuckets    = std::size_t(1) << kSubBucketBits;
+    static constexpr unsigned    kMaxExponent   = 38;   // 2^39 ns, about 9 minutes
+    static constexpr std::size_t kBuckets       = (kMaxExponent - kSubBucketBits + 2) * kSubBuckets;
+
+    /// The bucket holding `ns`.
+    static std::size_t bucket_of(std::uint64_t ns) {
+        if (ns < kSubBuckets) return static_cast<std::size_t>(ns);
+        const unsigned exponent = highest_bit(ns);
+        if (exponent > kMaxExponent) return kBuckets - 1;
+        const unsigned shift = exponent - kSubBucketBits;
+        return (shift + 1) * kSubBuckets + static_cast<std::size_t>((ns >> shift) & (kSubBuckets - 1));
+    }
+
+    /// The largest value that lands in `bucket`.
+    static std::uint64_t bucket_upper(std::size_t bucket) {
+        if (bucket < kSubBuckets) return bucket;
+        const unsigned shift = static_cast<unsigned>(bucket / kSubBuckets) - 1;
+        const std::uint64_t first = (kSubBuckets + bucket % kSubBuckets) << shift;
+        return first + (std::uint64_t(1) << shift) - 1;
+    }
+
+    void record(std::uint64_t ns) {
+        ++counts_[bucket_of(ns)];
+        ++count_;
+        sum_ += ns;
+        max_ = std::max(max_, ns);
+    }
+
+    /// Adds raw bucket contents, e.g. summed from per-thread shards.
+    void add_bucket(std::size_t bucket, std::uint64_t n) {
+        counts_[bucket] += n;
+        count_ += n;
+    }
+    void add_totals(std::uint64_t sum, std::uint64_t max) {
+        sum_ += sum;
+        max_ = std::max(max_, max);
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (std::size_t b = 0; b < kBuckets; ++b) counts_[b] += other.counts_[b];
+        count_ += other.count_;
+        add_totals(other.sum_, other.max_);
+    }
+
+    std::uint64_t count() const { return count_; }
+    std::uint64_t max() const { return max_; }
+    std::uint64_t bucket_count(std::size_t bucket) const { return counts_[bucket]; }
+    double mean() const { return count_ ? static_cast<double>(sum_) / static_cast<double>(count_) : 0.0; }
+
+    /// The smallest bucket bound at or below which a fraction `q` (0..1) of
+    /// the recorded values fall, capped at max(). 0 when empty.
+    std::uint64_t percentile(double q) const {
+        if (count_ == 0) return 0;
+        const double clamped = std::min(std::max(q, 0.0), 1.0);
+        const auto rank = std::max<std::uint64_t>(
+            1, static_cast<std::uint64_t>(std::ceil(clamped * static_cast<double>(count_))));
+        std::uint64_t seen = 0;
+        for (std::size_t b = 0; b < kBuckets; ++b) {
+            seen += counts_[b];
+            if (seen >= rank) return std::min(bucket_upper(b), max_);
+        }
+        return max_;
+    }
+
+private:
+    static unsigned highest_bit(std::uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63u - static_cast<unsigned>(__builtin_clzll(v));
+#else
+        unsigned bit = 0;
+        while (v >>= 1) ++bit;
+        return bit;
+#endif
+    }
+
+    std::array<std::uint64_t, kBuckets> counts_ {};
+    std::uint64_t count_ = 0;
+    std::uint64_t sum_   = 0;
+    std::uint64_t max_   = 0;
+};
+
+} // namespace governance
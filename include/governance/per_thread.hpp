@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace governance {
+
+// ── PaddedCounters ────────────────────────────────────────────────────────────
+
+/**
+ * PaddedCounters
+ *
+ * A fixed array of counters written by one thread and read by any, padded
+ * to whole cache lines so it shares no line with other threads' data. The
+ * single writer needs no read-modify-write: updates are a relaxed load and
+ * store, and the atomics only keep concurrent readers from seeing torn values.
+ */
+class PaddedCounters {
+public:
+    explicit PaddedCounters(std::size_t count)
+        : lines_(new Line[(count + kPerLine - 1) / kPerLine]()) {}
+
+    std::uint64_t load(std::size_t i) const {
+        return at(i).load(std::memory_order_relaxed);
+    }
+    void add(std::size_t i, std::uint64_t n = 1) {
+        auto& value = at(i);
+        value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+    void raise_to(std::size_t i, std::uint64_t n) {
+        auto& value = at(i);
+        if (n > value.load(std::memory_order_relaxed)) value.store(n, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::size_t kPerLine = 8;
+    struct alignas(64) Line {
+        std::atomic<std::uint64_t> values[kPerLine];
+    };
+
+    std::atomic<std::uint64_t>& at(std::size_t i) const { return lines_[i / kPerLine].values[i % kPerLine]; }
+
+    std::unique_ptr<Line[]> lines_;
+};
+
+// ── PerThread ─────────────────────────────────────────────────────────────────
+
+/**
+ * PerThread<T>
+ *
+ * One T per thread that calls local(), created on first use by `make` and
+ * kept until the PerThread is destroyed, so data written by exited threads
+ * is not lost. local() finds the calling thread's T through a small
+ * thread_local cache keyed by a never-reused instance id; it takes the
+ * mutex only the first time a thread uses an instance, or when the thread
+ * alternates between more instances than the cache holds.
+ */
+template <typename T>
+class PerThread {
+public:
+    explicit PerThread(std::function<std::unique_ptr<T>()> make)
+        : id_(next_id().fetch_add(1, std::memory_order_relaxed)), make_(std::move(make)) {}
+
+    PerThread(const PerThread&)            = delete;
+    PerThread& operator=(const PerThread&) = delete;
+
+    T& local() {
+        Slot& slot = slots()[id_ % kSlots];
+        if (slot.instance == id_) return *slot.value;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto self = std::this_thread::get_id();
+        T* value = nullptr;
+        // A recycled thread id may take over an exited thread's T.
+        for (const auto& entry : entries_)
+            if (entry.owner == self) value = entry.value.get();
+        if (!value) {
+            entries_.push_back({ self, make_() });
+            value = entries_.back().value.get();
+        }
+        slot = { id_, value };
+        return *value;
+    }
+
+    /// Calls fn(const T&) for every thread's T while holding the mutex.
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& entry : entries_) fn(static_cast<const T&>(*entry.value));
+    }
+
+private:
+    struct Slot {
+        std::uint64_t instance = 0;
+        T*            value    = nullptr;
+    };
+    struct Entry {
+        std::thread::id    owner;
+        std::unique_ptr<T> value;
+    };
+
+    static constexpr std::size_t kSlots = 4;
+    static Slot* slots() {
+        thread_local Slot cache[kSlots];
+        return cache;
+    }
+    static std::atomic<std::uint64_t>& next_id() {
+        static std::atomic<std::uint64_t> id { 1 };
+        return id;
+    }
+
+    const std::uint64_t                  id_;
+    std::function<std::unique_ptr<T>()>  make_;
+    mutable std::mutex                   mutex_;
+    std::vector<Entry>                   entries_;
+};
+
+} // namespace governance
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "governance/per_thread.hpp"
+#include "governance/policy_engine.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace governance {
+
+/**
+ * PolicyCounters
+ *
+ * Per-policy Allow / Deny / Abstain counters that evaluating threads update
+ * without contention. Every thread writes only its own shard (PaddedCounters
+ * via PerThread), so an increment moves no cache line between cores;
+ * snapshot() sums the shards.
+ */
+class PolicyCounters {
+public:
+    class Shard {
+    public:
+        explicit Shard(std::size_t policies) : counts_(1 + policies * 3) {}
+
+        void record_evaluation() { counts_.add(0); }
+        void record(std::size_t policy, const DecisionView* decision) {
+            const std::size_t outcome = !decision ? 2 : decision->effect == Effect::Allow ? 0 : 1;
+            counts_.add(1 + policy * 3 + outcome);
+        }
+
+    private:
+        friend class PolicyCounters;
+        PaddedCounters counts_;
+    };
+
+    explicit PolicyCounters(std::vector<std::string> policy_names);
+
+    /// The calling thread's shard, created on first use.
+    Shard& local() { return shards_.local(); }
+
+    PolicyCounterSnapshot snapshot() const;
+
+private:
+    const std::vector<std::string> names_;
+    PerThread<Shard>               shards_;
+};
+
+} // namespace governance
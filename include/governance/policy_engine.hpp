@@ -1,7 +1,11 @@
 #pragma once
 
+#include "governance/latency_histogram.hpp"
 #include "governance/types.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <ostream>
 #include <vector>
@@ -9,15 +13,43 @@
 
 namespace governance {
 
+class DecisionCache;
+class PolicyCounters;
+class PolicyProfiler;
+class ThreadPool;
+class TraceArena;
+struct EvaluationView;
+
 // A Policy is a named rule. Given a context, returns a decision or abstains.
 using PolicyFn = std::function<std::optional<PolicyDecision>(const RequestContext&)>;
 
+// The allocation-free form: the returned views must point at static storage.
+using PolicyViewFn = std::function<std::optional<DecisionView>(const RequestContext&)>;
+
 struct Policy {
     std::string name;
     std::string version;      // e.g. "1.0"
     std::string author;       // e.g. "governance-team"
     std::string description;
     PolicyFn    evaluate;
+
+    /// Request attributes `evaluate` reads. The default (all attributes) is
+    /// always correct but keeps the engine's decision cache disabled; declare
+    /// a narrower set to make the policy cacheable. A policy that reads ids,
+    /// department or tags is never cacheable.
+    AttributeSet reads = AttributeSet::all();
+
+    /// Preconditions the engine checks before calling `evaluate`. Requests
+    /// outside them are recorded as Abstain without invoking the policy, and
+    /// the engine indexes policies by role so role-specific policies cost
+    /// nothing for other roles. Empty (the default) means always applicable.
+    Applicability applies_to {};
+
+    /// Optional allocation-free equivalent of `evaluate` whose decisions
+    /// point at string literals. When set, the engine calls it instead of
+    /// `evaluate`; the two must agree. make_policy() sets both for static
+    /// policy types that return DecisionView, including the built-ins.
+    PolicyViewFn evaluate_view {};
 };
 
 // ── Trace types ───────────────────────────────────────────────────────────────
@@ -37,6 +69,10 @@ struct PolicyStep {
     std::string policy_name;
     StepOutcome outcome;
     std::string reason;   // empty when Abstain
+
+    /// Time spent in the policy, when the engine profiles with step
+    /// durations (see PolicyEngine::enable_profiling()); otherwise 0.
+    std::uint64_t duration_ns = 0;
 };
 
 struct EvaluationTrace {
@@ -57,6 +93,50 @@ struct EvaluationResult {
     EvaluationTrace trace;
 };
 
+/// Counters for the optional decision cache (see PolicyEngine::enable_cache()).
+struct CacheStats {
+    std::uint64_t hits          = 0;
+    std::uint64_t misses        = 0;
+    std::uint64_t evictions     = 0;
+    std::uint64_t invalidations = 0;
+    std::size_t   size          = 0;
+    std::size_t   capacity      = 0;
+
+    double hit_rate() const {
+        const auto total = hits + misses;
+        return total ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+    }
+};
+
+/// How often one policy was invoked and what it returned.
+struct PolicyCounts {
+    std::string   policy_name;
+    std::uint64_t allow   = 0;
+    std::uint64_t deny    = 0;
+    std::uint64_t abstain = 0;
+
+    std::uint64_t total() const { return allow + deny + abstain; }
+};
+
+/// Aggregated counters of an engine (see PolicyEngine::enable_counters()),
+/// one entry per registered policy in registration order.
+struct PolicyCounterSnapshot {
+    std::uint64_t             evaluations = 0;   // requests resolved by running policies
+    std::vector<PolicyCounts> policies;
+};
+
+/// Latency of one policy's invocations.
+struct PolicyLatency {
+    std::string      policy_name;
+    LatencyHistogram latency;
+};
+
+/// Per-policy latency histograms of an engine (see
+/// PolicyEngine::enable_profiling()), in registration order.
+struct PolicyProfile {
+    std::vector<PolicyLatency> policies;
+};
+
 /**
  * PolicyEngine
  *
@@ -66,6 +146,9 @@ struct EvaluationResult {
  *   1. First explicit Deny wins immediately.
  *   2. If at least one Allow and no Deny, access is granted.
  *   3. Default: Deny if no policy explicitly allows.
+ *
+ * evaluate() and decide() are const and may be called concurrently, provided
+ * the registered PolicyFns are themselves safe to call concurrently.
  */
 class PolicyEngine {
 public:
@@ -73,10 +156,123 @@ public:
 
     EvaluationResult evaluate(const RequestContext& ctx) const;
 
+    /// evaluate() without owning strings: steps are allocated in `arena`,
+    /// names point at the registered policies and reasons are copied into the
+    /// arena. With an arena reset between requests the trace costs no heap
+    /// allocation. See EvaluationView (trace_arena.hpp) for lifetimes.
+    EvaluationView evaluate(const RequestContext& ctx, TraceArena& arena) const;
+
+    /// Fast path: same resolution as evaluate(), but returns only the Effect.
+    /// No EvaluationTrace is built and the context is not copied, so the engine
+    /// itself performs no heap allocation. Use evaluate() when an audit trail is needed.
+    Effect decide(const RequestContext& ctx) const;
+
+    /// Evaluates `count` requests into `results[0..count)`, fanning the work
+    /// out over the engine's thread pool (see set_concurrency()). Each result
+    /// equals evaluate(requests[i]).
+    void evaluate_batch(const RequestContext* requests, std::size_t count,
+                        EvaluationResult* results) const;
+    std::vector<EvaluationResult> evaluate_batch(const std::vector<RequestContext>& requests) const;
+
+    /// Batch form of decide(): effects[i] == decide(requests[i]).
+    void decide_batch(const RequestContext* requests, std::size_t count,
+                      Effect* effects) const;
+    std::vector<Effect> decide_batch(const std::vector<RequestContext>& requests) const;
+
+    /// Number of threads (including the caller) used by the batch APIs.
+    /// 1, the default, evaluates batches on the calling thread; 0 selects
+    /// std::thread::hardware_concurrency(). Copies of the engine share the pool.
+    void        set_concurrency(std::size_t threads);
+    std::size_t concurrency() const;
+
+    /// Puts a bounded decision cache (CLOCK eviction) of `capacity` entries in
+    /// front of evaluate() and decide(). Entries are keyed on the union of the
+    /// attributes the registered policies declare in Policy::reads, and the
+    /// cache is bypassed while any policy is uncacheable. Registering a policy
+    /// invalidates it. A capacity of 0 disables the cache.
+    ///
+    /// `shards` splits the cache by key hash into independently locked
+    /// parts (see DecisionCache); pass DecisionCache::kShardPerCore (0) for
+    /// one per hardware thread when many threads share the engine.
+    void enable_cache(std::size_t capacity, std::size_t shards = 1);
+    void disable_cache();
+
+    /// True when a cache is enabled and every registered policy is cacheable.
+    bool       cache_active() const { return cache_ && cacheable_; }
+    CacheStats cache_stats() const;
+
+    /// Counts, per policy, how often it is invoked and whether it allows,
+    /// denies or abstains (see PolicyCounters). Only evaluations that run the
+    /// policies are counted: decision cache hits show up in cache_stats(),
+    /// and a policy ruled out by its preconditions is not invoked. Copies of
+    /// the engine share the counters; registering a policy starts new ones.
+    void enable_counters();
+    void disable_counters();
+    bool counters_enabled() const { return counters_ != nullptr; }
+
+    /// Sums every thread's counters. Empty when counting is disabled.
+    PolicyCounterSnapshot counter_snapshot() const;
+
+    /// Times every policy invocation into a per-policy LatencyHistogram,
+    /// recorded per thread like the counters. With `step_durations`,
+    /// evaluate() also fills PolicyStep::duration_ns. Costs two clock reads
+    /// per invoked policy; when disabled the cost is one branch per request.
+    /// Traces served from the decision cache carry the durations of the
+    /// evaluation that filled it. Registering a policy starts a new profile.
+    void enable_profiling(bool step_durations = false);
+    void disable_profiling();
+    bool profiling_enabled() const { return profiler_ != nullptr; }
+
+    /// Merges every thread's histograms. Empty when profiling is disabled.
+    PolicyProfile profile_snapshot() const;
+
+    /// Union of Policy::reads over the registered policies.
+    AttributeSet reads() const { return key_attributes_; }
+
+    /// True when every registered policy reads only bounded attributes
+    /// (see AttributeSet::cacheable()), so decisions depend on nothing else.
+    bool cacheable() const { return cacheable_; }
+
     std::size_t policy_count() const { return policies_.size(); }
 
 private:
-    std::vector<Policy> policies_;
+    EvaluationResult evaluate_uncached(const RequestContext& ctx) const;
+    Effect           decide_uncached(const RequestContext& ctx) const;
+    EvaluationView   evaluate_uncached(const RequestContext& ctx, TraceArena& arena) const;
+
+    /// The traced resolution loop shared by both evaluate() forms: calls
+    /// on_step(index, decision, borrowed, duration_ns) for each policy in
+    /// order, with a null decision when it abstains, until on_step returns
+    /// false. `borrowed` is true when the decision points at static storage
+    /// rather than at a PolicyDecision that only lives for the call;
+    /// `duration_ns` is 0 unless profiling with step durations.
+    template <typename OnStep>
+    void trace_policies(const RequestContext& ctx, OnStep&& on_step) const;
+
+    /// Indices of the policies that can apply to ctx's role, in registration order.
+    const std::vector<std::uint32_t>& candidates(const RequestContext& ctx) const {
+        const auto id = ctx.principal.role.id();
+        return candidate_lists_[id < list_of_role_.size() ? list_of_role_[id] : 0];
+    }
+    void rebuild_index();
+
+    template <typename Fn>
+    void for_each_chunk(std::size_t count, Fn&& fn) const;
+
+    std::vector<Policy>            policies_;
+
+    // Role index: list_of_role_[role id] selects an entry of candidate_lists_.
+    // Entry 0 holds the policies without a role precondition and serves every
+    // role that no policy names.
+    std::vector<std::vector<std::uint32_t>> candidate_lists_ { {} };
+    std::vector<std::uint32_t>              list_of_role_;
+
+    std::shared_ptr<ThreadPool>     pool_;
+    std::shared_ptr<DecisionCache>  cache_;
+    std::shared_ptr<PolicyCounters> counters_;
+    std::shared_ptr<PolicyProfiler> profiler_;
+    AttributeSet                    key_attributes_;     // union of Policy::reads
+    bool                            cacheable_ = true;   // every policy cacheable
 };
 
 // ── Built-in policies ────────────────────────────────────────────────────────
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "governance/latency_histogram.hpp"
+#include "governance/per_thread.hpp"
+#include "governance/policy_engine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace governance {
+
+/**
+ * PolicyProfiler
+ *
+ * Per-policy latency histograms (see LatencyHistogram) filled by evaluating
+ * threads without contention: each thread records into its own shard of
+ * padded counters, holding every policy's buckets plus its sum and maximum,
+ * and snapshot() merges the shards.
+ */
+class PolicyProfiler {
+public:
+    class Shard {
+    public:
+        explicit Shard(std::size_t policies) : counts_(policies * kStride) {}
+
+        void record(std::size_t policy, std::uint64_t ns) {
+            const std::size_t base = policy * kStride;
+            counts_.add(base + LatencyHistogram::bucket_of(ns));
+            counts_.add(base + kSum, ns);
+            counts_.raise_to(base + kMax, ns);
+        }
+
+    private:
+        friend class PolicyProfiler;
+        static constexpr std::size_t kSum    = LatencyHistogram::kBuckets;
+        static constexpr std::size_t kMax    = kSum + 1;
+        static constexpr std::size_t kStride = kMax + 1;
+
+        PaddedCounters counts_;
+    };
+
+    PolicyProfiler(std::vector<std::string> policy_names, bool step_durations);
+
+    /// The calling thread's shard, created on first use.
+    Shard& local() { return shards_.local(); }
+
+    /// Whether evaluate() should also fill PolicyStep::duration_ns.
+    bool step_durations() const { return step_durations_; }
+
+    PolicyProfile snapshot() const;
+
+private:
+    const std::vector<std::string> names_;
+    const bool                     step_durations_;
+    PerThread<Shard>               shards_;
+};
+
+} // namespace governance
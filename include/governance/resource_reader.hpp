@@ -0,0 +1,80 @@
+#pragma once
+
+// Streaming input for inventory exports in JSON Lines form: one JSON object
+// per line, for example
+//
+//   {"id": "db-1", "type": "database", "classification": "restricted", "tags": {"owner": "team-a"}}
+//
+// Members may come in any order. Unknown members are skipped, and missing
+// ones (or null) leave the field empty. Blank lines are ignored. Tag values
+// must be strings.
+
+#include "governance/types.hpp"
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace governance {
+
+/**
+ * ResourceReader
+ *
+ * Reads Resources from a JSONL stream in bounded memory: input is consumed
+ * through a fixed buffer that grows only for a line longer than itself, up
+ * to kMaxLine. next() parses into the caller's Resource and reuses its
+ * strings and tag storage, and it remembers the first kKeyCache tag keys it
+ * interns, so a steady stream of similar records parses without allocating
+ * or touching the symbol table.
+ *
+ * Types, classifications and tag keys are interned, and the symbol table
+ * never shrinks, so one reader adds at most `max_symbols` new symbols to it;
+ * a record that would add more is rejected like a malformed one. Values that
+ * are already interned (every name a rule uses) are always accepted.
+ */
+class ResourceReader {
+public:
+    static constexpr std::size_t kBufferSize = 64 * 1024;
+    static constexpr std::size_t kMaxLine    = 16 * 1024 * 1024;
+    static constexpr std::size_t kKeyCache   = 32;
+    static constexpr std::size_t kMaxSymbols = 64 * 1024;
+
+    explicit ResourceReader(std::istream& in, std::size_t max_symbols = kMaxSymbols);
+
+    /// Parses the next record into `out`. Returns false at the end of the
+    /// input. Throws std::runtime_error, naming the line, if the line is not
+    /// a valid record or is longer than kMaxLine; the line is consumed, so
+    /// the caller may log the error and keep reading. The same holds for a
+    /// record that would exceed `max_symbols` or find the symbol table full.
+    /// `out` is unspecified after a throw.
+    bool next(Resource& out);
+
+    /// 1-based number of the line last returned or rejected by next().
+    std::size_t line() const { return line_; }
+
+private:
+    bool next_line(std::string_view& line);
+    void parse(std::string_view line, Resource& out);
+    Symbol intern(const std::string& text);
+    Symbol intern_key(const std::string& key);
+
+    std::istream&     in_;
+    std::vector<char> buffer_;
+    std::size_t       begin_ = 0;   // unread input is buffer_[begin_, end_)
+    std::size_t       end_   = 0;
+    bool              eof_   = false;
+    std::size_t       line_  = 0;
+    std::size_t       max_symbols_;
+    std::size_t       symbols_ = 0;   // new symbols this reader has interned
+
+    // Decoding scratch, reused across records.
+    std::string                                      key_;
+    std::string                                      value_;
+    std::vector<std::pair<std::string, std::string>> tags_;
+    std::vector<std::pair<std::string, Symbol>>      keys_;   // interned tag keys
+};
+
+} // namespace governance
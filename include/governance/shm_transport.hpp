@@ -0,0 +1,232 @@
+#pragma once
+
+// Shared-memory transport for co-located callers (Linux only).
+//
+// A client creates a ShmChannel, a memfd holding two single-producer /
+// single-consumer rings: requests (client -> server) and responses
+// (server -> client). It hands the memfd to governance_authzd over a Unix
+// socket once; after that, decisions flow through shared memory with no
+// system calls. Each request slot holds one governance::wire request frame,
+// each response slot one response frame, so the encoding matches the socket
+// protocol and is written in place without allocation.
+
+#include "governance/policy_engine.hpp"
+#include "governance/wire.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace governance {
+
+// ── Backoff ───────────────────────────────────────────────────────────────────
+
+/**
+ * Adaptive wait for busy-polling loops: spins with a CPU pause hint first,
+ * then yields the CPU, then sleeps for exponentially longer intervals up to
+ * kMaxSleepMicros. reset() after useful work returns to spinning, so a busy
+ * peer is served with spin latency and an idle one costs almost no CPU.
+ */
+class Backoff {
+public:
+    static constexpr std::uint32_t kSpinSteps      = 128;
+    static constexpr std::uint32_t kYieldSteps     = 64;
+    static constexpr std::uint32_t kMaxSleepMicros = 200;
+
+    void pause();
+    void reset() { step_ = 0; }
+
+    /// True once pause() has moved past spinning and yielding.
+    bool sleeping() const { return step_ > kSpinSteps + kYieldSteps; }
+
+private:
+    std::uint32_t step_ = 0;
+};
+
+// ── SpscRing ──────────────────────────────────────────────────────────────────
+
+/// Producer and consumer positions of one ring, on separate cache lines.
+struct RingPositions {
+    alignas(64) std::atomic<std::uint64_t> head { 0 };   // slots published
+    alignas(64) std::atomic<std::uint64_t> tail { 0 };   // slots consumed
+};
+
+/**
+ * SpscRing
+ *
+ * A view of a fixed-slot ring in shared memory, used from one side only:
+ * either as the single producer (claim/publish) or the single consumer
+ * (read/release). Each side batches: claimed slots become visible to the
+ * consumer on publish(), and read slots are returned to the producer on
+ * release(). Each side caches the other's position and re-reads it only
+ * when the ring looks full or empty, so the shared cache lines move only
+ * when needed.
+ */
+class SpscRing {
+public:
+    enum class Side { Producer, Consumer };
+
+    SpscRing() = default;
+    SpscRing(Side side, RingPositions* positions, std::uint8_t* slots,
+             std::uint32_t slot_count, std::uint32_t slot_size);
+
+    std::uint32_t slot_size() const { return slot_size_; }
+
+    // Producer
+    std::uint8_t* try_claim();   // next free slot, or nullptr when full
+    void          publish();     // makes every claimed slot visible
+
+    // Consumer. A read slot may be overwritten once released.
+    const std::uint8_t* try_read();   // next published slot, or nullptr
+    void                release();    // returns every read slot
+
+private:
+    std::uint8_t* slot(std::uint64_t seq) const { return slots_ + (seq & mask_) * slot_size_; }
+
+    RingPositions* positions_ = nullptr;
+    std::uint8_t*  slots_     = nullptr;
+    std::uint64_t  mask_      = 0;
+    std::uint32_t  slot_size_ = 0;
+    std::uint64_t  count_     = 0;
+    std::uint64_t  local_     = 0;   // this side's position
+    std::uint64_t  limit_     = 0;   // cached bound from the other side's position
+};
+
+// ── ShmChannel ────────────────────────────────────────────────────────────────
+
+/**
+ * ShmChannel
+ *
+ * Owns a memfd-backed mapping laid out as a header, the request ring and the
+ * response ring. Move-only; unmaps and closes on destruction.
+ */
+class ShmChannel {
+public:
+    static constexpr std::uint32_t kDefaultSlots       = 1024;
+    static constexpr std::uint32_t kDefaultRequestSlot = 256;
+
+    /// Creates a new channel. `slots` is rounded up to a power of two;
+    /// requests larger than `request_slot_size` bytes cannot be sent.
+    /// Throws std::system_error if the memfd cannot be created or mapped.
+    static ShmChannel create(std::uint32_t slots             = kDefaultSlots,
+                             std::uint32_t request_slot_size = kDefaultRequestSlot);
+
+    /// Maps a channel received from a client, taking ownership of `fd`.
+    /// Throws std::system_error or std::invalid_argument if it is not a
+    /// valid channel.
+    static ShmChannel attach(int fd);
+
+    ShmChannel(ShmChannel&& other) noexcept;
+    ShmChannel& operator=(ShmChannel&& other) noexcept;
+    ~ShmChannel();
+
+    int fd() const { return fd_; }
+
+    /// Views of the two rings for the client (produces requests, consumes
+    /// responses) or the server (the reverse).
+    SpscRing requests(SpscRing::Side side) const;
+    SpscRing responses(SpscRing::Side side) const;
+
+    /// Set by the client when it goes away; the server stops serving.
+    void detach();
+    bool detached() const;
+
+private:
+    struct Header;
+
+    ShmChannel() = default;
+    Header* header() const { return static_cast<Header*>(base_); }
+
+    int         fd_   = -1;
+    void*       base_ = nullptr;
+    std::size_t size_ = 0;
+
+    // The ring layout, copied out of the header once checked: the client can
+    // still write the header, so the rings are never built from it.
+    std::uint32_t slots_             = 0;
+    std::uint32_t request_slot_size_ = 0;
+    std::size_t   request_offset_    = 0;
+    std::size_t   response_offset_   = 0;
+};
+
+// ── Client and server ─────────────────────────────────────────────────────────
+
+/**
+ * ShmClient
+ *
+ * The caller's side of a channel. submit() encodes requests straight into
+ * ring slots; flush() publishes them; poll() returns responses in request
+ * order. decide() wraps one round trip for simple callers.
+ *
+ * A server that stops (daemon restart, crash or shutdown) leaves requests
+ * unanswered. A client made by connect() notices through its connection to
+ * the daemon: server_gone() turns true, and decide() throws rather than
+ * wait forever. A client built on a bare ShmChannel has no such signal.
+ */
+class ShmClient {
+public:
+    explicit ShmClient(ShmChannel channel);
+
+    /// Creates a channel and hands it to the governance_authzd listening on
+    /// `socket_path` (its --shm-socket). Throws std::system_error on failure.
+    static ShmClient connect(const std::string& socket_path,
+                             std::uint32_t slots = ShmChannel::kDefaultSlots);
+
+    ShmClient(ShmClient&& other) noexcept;
+    ShmClient& operator=(ShmClient&&) = delete;
+    ~ShmClient();
+
+    /// Queues a request. Returns false if the request ring is full; throws
+    /// std::length_error if the request does not fit in a slot.
+    bool submit(std::uint32_t id, const RequestContext& ctx);
+    void flush();
+
+    /// Takes the next response, if one has arrived. Never blocks, so callers
+    /// waiting on it should check server_gone() once they start sleeping:
+    /// after the server has gone, no further response arrives.
+    bool poll(wire::Response& out);
+
+    /// True once the daemon has closed the connection, so requests still in
+    /// flight will not be answered. Costs a system call; always false for a
+    /// client without a connection.
+    bool server_gone() const;
+
+    /// One synchronous round trip. Requires no other requests in flight.
+    /// Throws std::system_error if the server goes away before answering;
+    /// the caller should treat that as Deny.
+    Effect decide(const RequestContext& ctx);
+
+private:
+    ShmChannel    channel_;
+    SpscRing      requests_;
+    SpscRing      responses_;
+    int           control_fd_ = -1;   // connection to the daemon, if any
+    std::uint32_t next_id_    = 0;
+};
+
+/**
+ * ShmServer
+ *
+ * Serves one channel: busy-polls the request ring with Backoff, decides
+ * each request with `engine` and writes the response ring. Requests are
+ * drained in batches and their responses published together.
+ */
+class ShmServer {
+public:
+    /// `control_fd`, if given, is the client's Unix socket; its hangup ends
+    /// run() even if the client died without detaching.
+    ShmServer(const PolicyEngine& engine, ShmChannel channel, int control_fd = -1);
+
+    /// Serves until the client detaches or hangs up, or `stop` becomes true.
+    void run(const std::atomic<bool>& stop);
+
+private:
+    bool client_gone() const;
+
+    const PolicyEngine& engine_;
+    ShmChannel          channel_;
+    int                 control_fd_;
+};
+
+} // namespace governance
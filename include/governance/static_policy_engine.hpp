@@ -0,0 +1,162 @@
+#pragma once
+
+#include "governance/builtin_policies.hpp"
+#include "governance/policy_engine.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace governance {
+
+namespace static_detail {
+
+template <typename P, typename = void>
+struct has_applicability : std::false_type {};
+
+template <typename P>
+struct has_applicability<P, std::void_t<decltype(P::applicability())>> : std::true_type {};
+
+template <typename P>
+inline constexpr bool returns_view_v = std::is_same_v<
+    std::invoke_result_t<const P&, const RequestContext&>, std::optional<DecisionView>>;
+
+inline PolicyDecision to_owned(const PolicyDecision& d) { return d; }
+inline PolicyDecision to_owned(const DecisionView& d)   { return d.to_decision(); }
+
+} // namespace static_detail
+
+/// Wraps a static policy type (see builtin_policies.hpp) as a type-erased
+/// Policy so it can be registered with a PolicyEngine. Types returning
+/// DecisionView also get the allocation-free Policy::evaluate_view.
+template <typename P>
+Policy make_policy(P policy = P{}) {
+    Policy result { P::name, P::version, P::author, P::description, {}, P::reads };
+    if constexpr (static_detail::returns_view_v<P>) {
+        result.evaluate = [policy](const RequestContext& ctx) -> std::optional<PolicyDecision> {
+            if (auto view = policy(ctx)) return view->to_decision();
+            return std::nullopt;
+        };
+        result.evaluate_view = PolicyViewFn(std::move(policy));
+    } else {
+        result.evaluate = PolicyFn(std::move(policy));
+    }
+    if constexpr (static_detail::has_applicability<P>::value) {
+        result.applies_to = P::applicability();
+    }
+    return result;
+}
+
+/**
+ * StaticPolicyEngine
+ *
+ * A policy chain fixed at compile time. Each policy is a plain callable type
+ * stored by value, so there is no std::function, no virtual dispatch and no
+ * indirect call: the compiler can inline the whole chain into evaluate() and
+ * decide().
+ *
+ * Resolution and trace output are identical to a PolicyEngine with the same
+ * policies registered in the same order.
+ */
+template <typename... Policies>
+class StaticPolicyEngine {
+public:
+    StaticPolicyEngine() = default;
+
+    /// Stores stateful policy instances; only needed when the types carry data.
+    template <typename... Ps, typename = std::enable_if_t<
+        sizeof...(Ps) != 0 && sizeof...(Ps) == sizeof...(Policies)>>
+    explicit StaticPolicyEngine(Ps&&... policies) : policies_(std::forward<Ps>(policies)...) {}
+
+    EvaluationResult evaluate(const RequestContext& ctx) const {
+        EvaluationResult result { {}, { ctx, {} } };
+        result.trace.steps.reserve(sizeof...(Policies));
+        std::optional<PolicyDecision> first_allow;
+
+        const bool denied = evaluate_each(ctx, result, first_allow,
+                                          std::index_sequence_for<Policies...>{});
+        if (!denied) {
+            result.decision = first_allow
+                ? std::move(*first_allow)
+                : PolicyDecision{ Effect::Deny, "default", "No policy explicitly granted access." };
+        }
+        return result;
+    }
+
+    Effect decide(const RequestContext& ctx) const {
+        bool allowed = false;
+        const bool denied = decide_each(ctx, allowed, std::index_sequence_for<Policies...>{});
+        return !denied && allowed ? Effect::Allow : Effect::Deny;
+    }
+
+    /// Union of the policies' declared reads.
+    static constexpr AttributeSet reads() { return (AttributeSet{} | ... | Policies::reads); }
+
+    static constexpr std::size_t policy_count() { return sizeof...(Policies); }
+
+    /// The same chain as a dynamic PolicyEngine.
+    PolicyEngine to_policy_engine() const {
+        PolicyEngine engine;
+        std::apply([&](const auto&... p) { (engine.register_policy(make_policy(p)), ...); }, policies_);
+        return engine;
+    }
+
+private:
+    // Each helper returns true when the policy denied, which stops the
+    // short-circuiting fold over the remaining policies.
+
+    template <std::size_t... I>
+    bool evaluate_each(const RequestContext& ctx, EvaluationResult& result,
+                       std::optional<PolicyDecision>& first_allow,
+                       std::index_sequence<I...>) const {
+        return (evaluate_one<I>(ctx, result, first_allow) || ...);
+    }
+
+    template <std::size_t I>
+    bool evaluate_one(const RequestContext& ctx, EvaluationResult& result,
+                      std::optional<PolicyDecision>& first_allow) const {
+        using P = std::tuple_element_t<I, std::tuple<Policies...>>;
+        auto decision = std::get<I>(policies_)(ctx);
+        if (!decision) {
+            result.trace.steps.push_back({ P::name, StepOutcome::Abstain, "" });
+            return false;
+        }
+        if (decision->effect == Effect::Deny) {
+            result.trace.steps.push_back({ P::name, StepOutcome::Deny, std::string(decision->reason) });
+            result.decision = static_detail::to_owned(*decision);
+            return true;
+        }
+        result.trace.steps.push_back({ P::name, StepOutcome::Allow, std::string(decision->reason) });
+        if (!first_allow) first_allow = static_detail::to_owned(*decision);
+        return false;
+    }
+
+    template <std::size_t... I>
+    bool decide_each(const RequestContext& ctx, bool& allowed, std::index_sequence<I...>) const {
+        return (decide_one<I>(ctx, allowed) || ...);
+    }
+
+    template <std::size_t I>
+    bool decide_one(const RequestContext& ctx, bool& allowed) const {
+        auto decision = std::get<I>(policies_)(ctx);
+        if (!decision) return false;
+        if (decision->effect == Effect::Deny) return true;
+        allowed = true;
+        return false;
+    }
+
+    std::tuple<Policies...> policies_;
+};
+
+/// The built-in policies in the same order as default_policy_engine().
+using DefaultStaticPolicyEngine = StaticPolicyEngine<
+    builtin::AdminFullAccess,
+    builtin::MFARequiredForRestricted,
+    builtin::ProductionImmutability,
+    builtin::AnalystReadOnly,
+    builtin::EngineerAccess>;
+
+} // namespace governance
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace governance {
+
+/**
+ * Symbol
+ *
+ * An interned string. Constructing a Symbol resolves the text once against a
+ * process-wide symbol table and keeps only a 32-bit id, so comparing two
+ * Symbols is a single integer compare. The original text stays available
+ * through str() for traces, JSON and logging.
+ *
+ * Symbols convert implicitly from string types, so request attributes can
+ * still be written as literals:  ctx.environment = "production";
+ *
+ * The symbol table is thread-safe and never shrinks; intern attribute values
+ * drawn from a bounded vocabulary (roles, verbs, classifications, ...), not
+ * unbounded identifiers.
+ */
+class Symbol {
+public:
+    /// The empty symbol (id 0, text "").
+    constexpr Symbol() = default;
+
+    Symbol(std::string_view text);
+    Symbol(const std::string& text) : Symbol(std::string_view(text)) {}
+    Symbol(const char* text)        : Symbol(std::string_view(text)) {}
+
+    /// Rebuilds a Symbol from an id previously returned by id().
+    static constexpr Symbol from_id(std::uint32_t id) {
+        Symbol s;
+        s.id_ = id;
+        return s;
+    }
+
+    /// Returns the Symbol for `text` if it has already been interned. Never
+    /// grows the table, so it is safe to call with untrusted input.
+    static std::optional<Symbol> lookup(std::string_view text);
+
+    /// Number of distinct symbols interned so far (including the empty symbol).
+    static std::size_t table_size();
+
+    constexpr std::uint32_t id() const { return id_; }
+    constexpr bool          empty() const { return id_ == 0; }
+    const std::string&      str() const;
+
+    friend constexpr bool operator==(Symbol a, Symbol b) { return a.id_ == b.id_; }
+    friend constexpr bool operator!=(Symbol a, Symbol b) { return a.id_ != b.id_; }
+    friend constexpr bool operator<(Symbol a, Symbol b)  { return a.id_ <  b.id_; }
+
+    // Comparisons against plain text compare the interned string and never intern.
+    friend bool operator==(Symbol a, std::string_view b)        { return a.str() == b; }
+    friend bool operator==(Symbol a, const std::string& b)      { return a.str() == b; }
+    friend bool operator==(Symbol a, const char* b)             { return a.str() == b; }
+    friend bool operator==(std::string_view a, Symbol b)        { return b == a; }
+    friend bool operator==(const std::string& a, Symbol b)      { return b == a; }
+    friend bool operator==(const char* a, Symbol b)             { return b == a; }
+    friend bool operator!=(Symbol a, std::string_view b)        { return !(a == b); }
+    friend bool operator!=(Symbol a, const std::string& b)      { return !(a == b); }
+    friend bool operator!=(Symbol a, const char* b)             { return !(a == b); }
+    friend bool operator!=(std::string_view a, Symbol b)        { return !(b == a); }
+    friend bool operator!=(const std::string& a, Symbol b)      { return !(b == a); }
+    friend bool operator!=(const char* a, Symbol b)             { return !(b == a); }
+
+private:
+    std::uint32_t id_ = 0;
+};
+
+inline std::ostream& operator<<(std::ostream& os, Symbol s) {
+    return os << s.str();
+}
+
+// ── Well-known vocabulary ─────────────────────────────────────────────────────
+//
+// The attribute values used by the built-in policies and rules are interned at
+// fixed ids when the table is created, so they can be used as compile-time
+// constants and as dense indices (ids 1..well_known_count-1).
+
+namespace symbols {
+
+inline constexpr Symbol role_admin          = Symbol::from_id(1);
+inline constexpr Symbol role_engineer       = Symbol::from_id(2);
+inline constexpr Symbol role_analyst        = Symbol::from_id(3);
+inline constexpr Symbol role_guest          = Symbol::from_id(4);
+
+inline constexpr Symbol type_database       = Symbol::from_id(5);
+inline constexpr Symbol type_storage        = Symbol::from_id(6);
+inline constexpr Symbol type_compute        = Symbol::from_id(7);
+inline constexpr Symbol type_secret         = Symbol::from_id(8);
+
+inline constexpr Symbol class_public        = Symbol::from_id(9);
+inline constexpr Symbol class_internal      = Symbol::from_id(10);
+inline constexpr Symbol class_confidential  = Symbol::from_id(11);
+inline constexpr Symbol class_restricted    = Symbol::from_id(12);
+
+inline constexpr Symbol verb_read           = Symbol::from_id(13);
+inline constexpr Symbol verb_write          = Symbol::from_id(14);
+inline constexpr Symbol verb_delete         = Symbol::from_id(15);
+inline constexpr Symbol verb_execute        = Symbol::from_id(16);
+
+inline constexpr Symbol env_production      = Symbol::from_id(17);
+inline constexpr Symbol env_staging         = Symbol::from_id(18);
+inline constexpr Symbol env_dev             = Symbol::from_id(19);
+
+inline constexpr std::uint32_t well_known_count = 20;
+
+} // namespace symbols
+
+} // namespace governance
+
+namespace std {
+
+template <>
+struct hash<governance::Symbol> {
+    std::size_t operator()(governance::Symbol s) const noexcept {
+        return std::hash<std::uint32_t>{}(s.id());
+    }
+};
+
+} // namespace std
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "governance/symbol.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace governance {
+
+/**
+ * TagKey
+ *
+ * A key to look a tag up by: a Symbol, compared as an integer, or text,
+ * compared against the interned key names without interning anything, so
+ * lookups with untrusted keys never grow the symbol table. Hot paths should
+ * hold the Symbol.
+ */
+class TagKey {
+public:
+    TagKey(Symbol key) : symbol_(key), by_symbol_(true) {}
+    TagKey(std::string_view key) : text_(key) {}
+    TagKey(const std::string& key) : text_(key) {}
+    TagKey(const char* key) : text_(key) {}
+
+    bool             by_symbol() const { return by_symbol_; }
+    Symbol           symbol() const { return symbol_; }
+    std::string_view text() const { return text_; }
+
+private:
+    Symbol           symbol_;
+    std::string_view text_;
+    bool             by_symbol_ = false;
+};
+
+/**
+ * TagSet
+ *
+ * A resource's tags, sized for the handful most resources carry. Keys are
+ * interned Symbols; entries are kept sorted by key id in a small vector
+ * whose first kInlineTags entries live inside the TagSet, and the values
+ * are packed back to back in one string. A resource with a few short tags
+ * therefore allocates nothing, copies with at most one allocation, and a
+ * lookup is a scan over a few adjacent 12-byte entries.
+ *
+ * Keys come from a bounded vocabulary (owner, env, region, ...), so they are
+ * interned; values are not, since they are often unique per resource.
+ * Iteration is in key id order and yields Tag{key, value} by value; the
+ * value views stay valid until the set is next modified.
+ *
+ * For code written against the old map, a TagSet converts from and to
+ * std::unordered_map<std::string, std::string> and offers count(), find(),
+ * at() and erase() with map semantics.
+ */
+class TagSet {
+public:
+    static constexpr std::size_t kInlineTags = 4;
+
+    struct Tag {
+        Symbol           key;
+        std::string_view value;
+    };
+
+private:
+    struct Entry {
+        Symbol        key;
+        std::uint32_t offset = 0;   // into values_
+        std::uint32_t size   = 0;
+    };
+
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Tag;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = Tag;
+
+        struct pointer {
+            Tag tag;
+            const Tag* operator->() const { return &tag; }
+        };
+
+        const_iterator() = default;
+
+        Tag     operator*() const { return { entry_->key, { values_ + entry_->offset, entry_->size } }; }
+        pointer operator->() const { return { **this }; }
+
+        const_iterator& operator++() { ++entry_; return *this; }
+        const_iterator  operator++(int) { auto it = *this; ++entry_; return it; }
+
+        friend bool operator==(const_iterator a, const_iterator b) { return a.entry_ == b.entry_; }
+        friend bool operator!=(const_iterator a, const_iterator b) { return a.entry_ != b.entry_; }
+
+    private:
+        friend class TagSet;
+        const_iterator(const Entry* entry, const char* values) : entry_(entry), values_(values) {}
+
+        const Entry* entry_  = nullptr;
+        const char*  values_ = nullptr;
+    };
+    using iterator = const_iterator;
+
+    TagSet() = default;
+    TagSet(std::initializer_list<std::pair<std::string_view, std::string_view>> tags);
+
+    /// Compatibility adapter: the tags of an unordered_map, as Resource held them.
+    TagSet(const std::unordered_map<std::string, std::string>& tags);
+
+    std::size_t size() const { return size_; }
+    bool        empty() const { return size_ == 0; }
+
+    const_iterator begin() const { return { entries(), values_.data() }; }
+    const_iterator end() const { return { entries() + size_, values_.data() }; }
+
+    const_iterator find(const TagKey& key) const { return { entries() + index_of(key), values_.data() }; }
+    std::size_t    count(const TagKey& key) const { return index_of(key) != size_; }
+    bool           contains(const TagKey& key) const { return index_of(key) != size_; }
+
+    /// The value of `key`. Throws std::out_of_range if it is absent.
+    std::string_view at(const TagKey& key) const;
+
+    /// Sets `key` to `value`, adding the key if absent (insert_or_assign).
+    void set(Symbol key, std::string_view value);
+
+    /// Removes `key`. Returns the number of tags removed, 0 or 1.
+    std::size_t erase(const TagKey& key);
+
+    /// Removes every tag, keeping the storage for reuse.
+    void clear();
+
+    std::unordered_map<std::string, std::string> to_map() const;
+
+    friend bool operator==(const TagSet& a, const TagSet& b);
+    friend bool operator!=(const TagSet& a, const TagSet& b) { return !(a == b); }
+
+private:
+    const Entry* entries() const { return size_ > kInlineTags ? spill_.data() : inline_; }
+    Entry*       entries() { return size_ > kInlineTags ? spill_.data() : inline_; }
+
+    // Index of `key` in entries(), or size_ if absent. Inline so a lookup by
+    // Symbol compiles to a scan of the inline entries at the call site.
+    std::size_t index_of(const TagKey& key) const {
+        if (!key.by_symbol()) return index_of_text(key.text());
+        if (size_ > kInlineTags) return index_of_spilled(key.symbol());
+        const auto id = key.symbol().id();
+        for (std::size_t i = 0; i < size_ && inline_[i].key.id() <= id; ++i) {
+            if (inline_[i].key.id() == id) return i;
+        }
+        return size_;
+    }
+
+    std::size_t   index_of_spilled(Symbol key) const;
+    std::size_t   index_of_text(std::string_view key) const;
+    std::uint32_t append_value(std::string_view value);
+    void          compact();
+
+    Entry              inline_[kInlineTags] = {};
+    std::vector<Entry> spill_;        // holds every entry once size_ > kInlineTags
+    std::string        values_;
+    std::uint32_t      size_ = 0;
+    std::uint32_t      dead_ = 0;     // bytes of values_ no entry refers to
+};
+
+} // namespace governance
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace governance {
+
+/**
+ * ThreadPool
+ *
+ * A fixed set of worker threads that execute one parallel loop at a time.
+ * parallel_for() splits [0, count) into chunks that threads claim from a
+ * shared atomic cursor, so uneven chunks balance out without a central queue.
+ * The calling thread participates, so a pool of concurrency N starts N-1
+ * workers.
+ *
+ * If the pool is already running a loop for another caller, parallel_for()
+ * runs the new loop inline on the calling thread instead of blocking.
+ */
+class ThreadPool {
+public:
+    /// `concurrency` is the total number of threads including the caller;
+    /// 0 selects std::thread::hardware_concurrency().
+    explicit ThreadPool(std::size_t concurrency = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t concurrency() const { return workers_.size() + 1; }
+
+    using RangeFn = std::function<void(std::size_t begin, std::size_t end)>;
+
+    /// Calls fn(begin, end) over [0, count) in chunks of at most `chunk` items
+    /// and blocks until every chunk has run. The first exception thrown by fn
+    /// is rethrown here once all threads have stopped.
+    void parallel_for(std::size_t count, std::size_t chunk, const RangeFn& fn);
+
+private:
+    struct Job {
+        const RangeFn*           fn    = nullptr;
+        std::size_t              count = 0;
+        std::size_t              chunk = 1;
+        std::atomic<std::size_t> next { 0 };
+        std::exception_ptr       error;
+        std::mutex               error_mutex;
+    };
+
+    void worker_loop();
+    static void run_chunks(Job& job);
+
+    std::vector<std::thread> workers_;
+    std::mutex               submit_mutex_;   // one loop at a time
+
+    std::mutex               mutex_;
+    std::condition_variable  wake_;
+    std::condition_variable  done_;
+    Job*                     job_        = nullptr;
+    std::uint64_t            generation_ = 0;
+    std::size_t              active_     = 0;
+    bool                     stop_       = false;
+};
+
+} // namespace governance
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "governance/policy_engine.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace governance {
+
+/**
+ * TraceArena
+ *
+ * A bump allocator for evaluation traces. Allocation advances a cursor
+ * through a chain of blocks; nothing is freed individually. reset() rewinds
+ * the cursor but keeps the blocks, so an arena reused across requests stops
+ * touching the heap once it has grown to fit the largest trace.
+ *
+ * Not thread-safe: use one arena per thread.
+ */
+class TraceArena {
+public:
+    explicit TraceArena(std::size_t block_size = 4096);
+
+    TraceArena(const TraceArena&)            = delete;
+    TraceArena& operator=(const TraceArena&) = delete;
+
+    void* allocate(std::size_t size, std::size_t alignment);
+
+    /// Uninitialised storage for `n` objects of a trivially destructible type.
+    template <typename T>
+    T* allocate_array(std::size_t n) {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "TraceArena never runs destructors");
+        return static_cast<T*>(allocate(sizeof(T) * n, alignof(T)));
+    }
+
+    /// Copies `text` into the arena and returns a view of the copy.
+    std::string_view store(std::string_view text);
+
+    /// Invalidates everything allocated so far and makes the memory reusable.
+    void reset();
+
+    std::size_t bytes_used() const;       // since the last reset()
+    std::size_t bytes_reserved() const;   // total block capacity
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t                  size = 0;
+    };
+
+    std::vector<Block> blocks_;
+    std::size_t        block_size_;
+    std::size_t        current_ = 0;   // block the cursor is in
+    std::size_t        offset_  = 0;   // cursor within blocks_[current_]
+    std::size_t        retired_ = 0;   // bytes of blocks before current_
+};
+
+// ── Borrowed trace types ──────────────────────────────────────────────────────
+
+/// A PolicyStep that borrows its strings.
+struct StepView {
+    std::string_view policy_name;
+    StepOutcome      outcome;
+    std::string_view reason;   // empty when Abstain
+    std::uint64_t    duration_ns = 0;
+
+    PolicyStep to_step() const {
+        return { std::string(policy_name), outcome, std::string(reason), duration_ns };
+    }
+};
+
+/// An EvaluationTrace whose steps live in a TraceArena and whose context is
+/// the caller's request.
+struct TraceView {
+    const RequestContext* context    = nullptr;
+    const StepView*       steps      = nullptr;
+    std::size_t           step_count = 0;
+
+    const StepView* begin() const { return steps; }
+    const StepView* end()   const { return steps + step_count; }
+    std::size_t     size()  const { return step_count; }
+    const StepView& operator[](std::size_t i) const { return steps[i]; }
+
+    std::size_t evaluated_count() const {
+        std::size_t count = 0;
+        for (const auto& s : *this)
+            if (s.outcome != StepOutcome::Abstain) ++count;
+        return count;
+    }
+    std::size_t abstain_count() const { return step_count - evaluated_count(); }
+
+    EvaluationTrace to_trace() const;
+};
+
+/**
+ * EvaluationView
+ *
+ * The result of PolicyEngine::evaluate(ctx, arena). Policy names point at the
+ * engine's Policy::name strings, reasons at static storage or copies in the
+ * arena, and the context at the caller's request. It stays valid until the
+ * arena is reset, the engine is modified or destroyed, or the request goes
+ * away. to_result() makes an owning copy.
+ */
+struct EvaluationView {
+    DecisionView decision;
+    TraceView    trace;
+
+    EvaluationResult to_result() const {
+        return { decision.to_decision(), trace.to_trace() };
+    }
+};
+
+} // namespace governance
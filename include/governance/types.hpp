@@ -1,44 +1,167 @@
 #pragma once
 
+#include "governance/symbol.hpp"
+#include "governance/tag_set.hpp"
+
+#include <cstdint>
+#include <initializer_list>
 #include <ostream>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <vector>
 
 namespace governance {
 
 enum class Effect { Allow, Deny };
 
+// Attributes that policies branch on are interned Symbols: they are resolved
+// once when the context is built and compared as integers during evaluation.
+
 struct Principal {
     std::string id;
-    std::string role;           // "admin", "engineer", "analyst", "guest"
+    Symbol      role;           // "admin", "engineer", "analyst", "guest"
     std::string department;
 };
 
 struct Resource {
     std::string id;
-    std::string type;           // "database", "storage", "compute", "secret"
-    std::string classification; // "public", "internal", "confidential", "restricted"
-    std::unordered_map<std::string, std::string> tags;
+    Symbol      type;           // "database", "storage", "compute", "secret"
+    Symbol      classification; // "public", "internal", "confidential", "restricted"
+    TagSet      tags;           // "owner", "env", "region", ...
 };
 
 struct Action {
-    std::string verb;           // "read", "write", "delete", "execute"
+    Symbol      verb;           // "read", "write", "delete", "execute"
 };
 
 struct RequestContext {
     Principal   principal;
     Resource    resource;
     Action      action;
-    std::string environment;    // "production", "staging", "dev"
+    Symbol      environment;    // "production", "staging", "dev"
     bool        mfa_verified = false;
 };
 
+// ── Attributes ────────────────────────────────────────────────────────────────
+
+/// A RequestContext field that a policy may read.
+enum class Attribute : std::uint8_t {
+    Role,
+    Department,
+    PrincipalId,
+    ResourceType,
+    Classification,
+    ResourceId,
+    Tags,
+    Verb,
+    Environment,
+    Mfa,
+};
+
+/// A set of Attributes, stored as a bitmask.
+class AttributeSet {
+public:
+    constexpr AttributeSet() = default;
+    constexpr AttributeSet(std::initializer_list<Attribute> attrs) {
+        for (auto a : attrs) bits_ |= bit(a);
+    }
+
+    /// Every attribute: the conservative declaration for a policy whose inputs are unknown.
+    static constexpr AttributeSet all() {
+        AttributeSet s;
+        s.bits_ = (1u << (static_cast<unsigned>(Attribute::Mfa) + 1)) - 1;
+        return s;
+    }
+
+    constexpr bool contains(Attribute a) const { return (bits_ & bit(a)) != 0; }
+    constexpr bool empty() const { return bits_ == 0; }
+    constexpr std::uint32_t bits() const { return bits_; }
+
+    /// True when every attribute is an interned Symbol or mfa_verified, i.e.
+    /// the set can form a compact decision-cache key. Ids, department and tags
+    /// are unbounded and make a policy uncacheable.
+    constexpr bool cacheable() const {
+        return !contains(Attribute::PrincipalId) && !contains(Attribute::Department) &&
+               !contains(Attribute::ResourceId)  && !contains(Attribute::Tags);
+    }
+
+    constexpr AttributeSet& operator|=(AttributeSet o) { bits_ |= o.bits_; return *this; }
+    friend constexpr AttributeSet operator|(AttributeSet a, AttributeSet b) { return a |= b; }
+    friend constexpr bool operator==(AttributeSet a, AttributeSet b) { return a.bits_ == b.bits_; }
+    friend constexpr bool operator!=(AttributeSet a, AttributeSet b) { return a.bits_ != b.bits_; }
+
+private:
+    static constexpr std::uint32_t bit(Attribute a) { return 1u << static_cast<unsigned>(a); }
+    std::uint32_t bits_ = 0;
+};
+
+// ── Applicability ─────────────────────────────────────────────────────────────
+
+/**
+ * Preconditions under which a policy can return a decision. Each non-empty
+ * list restricts one attribute to the listed values; empty lists match
+ * anything. A request outside them is recorded as Abstain without invoking
+ * the policy, so a policy must abstain whenever its preconditions fail.
+ */
+struct Applicability {
+    std::vector<Symbol> roles;
+    std::vector<Symbol> resource_types;
+    std::vector<Symbol> classifications;
+    std::vector<Symbol> verbs;
+    std::vector<Symbol> environments;
+
+    bool matches(const RequestContext& ctx) const {
+        return admits(roles,           ctx.principal.role) &&
+               admits(resource_types,  ctx.resource.type) &&
+               admits(classifications, ctx.resource.classification) &&
+               admits(verbs,           ctx.action.verb) &&
+               admits(environments,    ctx.environment);
+    }
+
+    /// The attributes the preconditions inspect.
+    AttributeSet reads() const {
+        AttributeSet s;
+        if (!roles.empty())           s |= { Attribute::Role };
+        if (!resource_types.empty())  s |= { Attribute::ResourceType };
+        if (!classifications.empty()) s |= { Attribute::Classification };
+        if (!verbs.empty())           s |= { Attribute::Verb };
+        if (!environments.empty())    s |= { Attribute::Environment };
+        return s;
+    }
+
+private:
+    static bool admits(const std::vector<Symbol>& allowed, Symbol value) {
+        if (allowed.empty()) return true;
+        for (auto a : allowed)
+            if (a == value) return true;
+        return false;
+    }
+};
+
 struct PolicyDecision {
     Effect      effect;
     std::string policy_name;
     std::string reason;
 };
 
+/// A PolicyDecision that borrows its strings; to_decision() makes an owning
+/// copy. Policies that decide with string literals return these so that a
+/// firing policy costs no allocation.
+struct DecisionView {
+    Effect           effect;
+    std::string_view policy_name;
+    std::string_view reason;
+
+    PolicyDecision to_decision() const {
+        return { effect, std::string(policy_name), std::string(reason) };
+    }
+};
+
+/// Views an owning decision; valid while `d` is alive and unchanged.
+inline DecisionView view_of(const PolicyDecision& d) {
+    return { d.effect, d.policy_name, d.reason };
+}
+
 inline std::ostream& operator<<(std::ostream& os, Effect e) {
     return os << (e == Effect::Allow ? "Allow" : "Deny");
 }
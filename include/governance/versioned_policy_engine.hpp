@@ -0,0 +1,94 @@
+#pragma once
+
+#include "governance/policy_engine.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace governance {
+
+/**
+ * VersionedPolicyEngine
+ *
+ * A PolicyEngine whose policy set can be replaced while other threads are
+ * evaluating requests. Each version is an immutable PolicyEngine snapshot.
+ * Writers build the next snapshot and publish it atomically; readers keep
+ * evaluating against the snapshot they hold until they see the new version.
+ *
+ * Readers cache the current snapshot per thread, so in the steady state an
+ * evaluation costs one atomic load of the version counter on top of the
+ * engine itself. The first call on a thread after a swap takes a short lock
+ * to pick up the new snapshot and drops its reference to the old one; it
+ * contends only with the pointer swap itself, never with a writer building
+ * or copying a policy set. An
+ * old snapshot is destroyed once every thread that used it has moved on to
+ * a newer version or exited, and every snapshot is released when the engine
+ * is destroyed. A thread may use any number of engines without their caches
+ * evicting one another.
+ *
+ * Policies must not call back into a VersionedPolicyEngine from inside
+ * evaluation.
+ */
+class VersionedPolicyEngine {
+public:
+    explicit VersionedPolicyEngine(PolicyEngine initial = PolicyEngine{});
+
+    VersionedPolicyEngine(const VersionedPolicyEngine&)            = delete;
+    VersionedPolicyEngine& operator=(const VersionedPolicyEngine&) = delete;
+    ~VersionedPolicyEngine();
+
+    // ── Readers ──────────────────────────────────────────────────────────────
+
+    EvaluationResult evaluate(const RequestContext& ctx) const { return current().evaluate(ctx); }
+    Effect           decide(const RequestContext& ctx) const   { return current().decide(ctx); }
+
+    /// Arena-backed evaluate(). The view also points into the snapshot, so it
+    /// is valid only until the calling thread's next call into this engine.
+    EvaluationView evaluate(const RequestContext& ctx, TraceArena& arena) const;
+
+    /// The snapshot the calling thread currently sees. Holding it pins that
+    /// version, e.g. to evaluate a group of requests against one policy set.
+    std::shared_ptr<const PolicyEngine> snapshot() const;
+
+    /// Number of published versions; the initial engine is version 1.
+    std::uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+    // ── Writers ──────────────────────────────────────────────────────────────
+
+    /// Replaces the policy set and returns the new version.
+    std::uint64_t publish(PolicyEngine next);
+
+    /// Copies the latest snapshot, applies modify(PolicyEngine&) to the copy
+    /// and publishes it. Concurrent updates are serialised, so none is lost.
+    /// Readers are not blocked while `modify` runs.
+    template <typename Fn>
+    std::uint64_t update(Fn&& modify) {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        PolicyEngine next = *current_;   // only writers replace current_
+        std::forward<Fn>(modify)(next);
+        return publish_locked(std::move(next));
+    }
+
+private:
+    struct ThreadSnapshot;   // one thread's cached snapshot of this engine
+
+    const PolicyEngine& current() const;
+    ThreadSnapshot&     thread_snapshot() const;
+    std::uint64_t       publish_locked(PolicyEngine next);   // caller holds writer_mutex_
+
+    const std::uint64_t                 id_;             // keys the per-thread cache
+    std::atomic<std::uint64_t>          version_ { 1 };
+    std::mutex                          writer_mutex_;   // serialises writers
+    mutable std::mutex                  mutex_;          // current_ swaps; reader refresh
+    std::shared_ptr<const PolicyEngine> current_;
+
+    // Every thread's cache entry for this engine, so the destructor can
+    // release their snapshots. Guarded by mutex_.
+    mutable std::vector<std::weak_ptr<ThreadSnapshot>> threads_;
+};
+
+} // namespace governance
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "governance/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace governance::wire {
+
+// ── Protocol ──────────────────────────────────────────────────────────────────
+//
+// The binary protocol spoken by governance_authzd. Every message is a frame:
+//
+//   u32 payload length | payload
+//
+// Integers are little-endian. A request payload is
+//
+//   u32 id | u8 flags (bit 0: mfa_verified)
+//   str8  role, resource type, classification, verb, environment
+//   str16 principal id, department, resource id
+//   u16 tag count | (str16 key, str16 value) * count
+//
+// where strN is an N-bit length followed by that many bytes. A response
+// payload is
+//
+//   u32 id | u8 status | u8 effect (0 Allow, 1 Deny)
+//
+// The id is chosen by the client and echoed back, so a client may pipeline
+// any number of requests on one connection. Responses arrive in request order.
+
+constexpr std::size_t   kHeaderSize      = 4;
+constexpr std::uint32_t kMaxPayload      = 64 * 1024;
+constexpr std::size_t   kResponsePayload = 6;
+constexpr std::size_t   kResponseSize    = kHeaderSize + kResponsePayload;
+
+enum class Status : std::uint8_t {
+    Ok        = 0,
+    Malformed = 1,   // the request payload could not be decoded; effect is Deny
+};
+
+struct Response {
+    std::uint32_t id     = 0;
+    Status        status = Status::Ok;
+    Effect        effect = Effect::Deny;
+};
+
+/// Payload length of the frame at the front of `data`, or nullopt if fewer
+/// than kHeaderSize bytes are available. The caller checks it against
+/// kMaxPayload before waiting for the payload.
+std::optional<std::uint32_t> payload_length(const std::uint8_t* data, std::size_t size);
+
+/// Size of the framed request for `ctx`, header included. Throws
+/// std::length_error if a field is too long for its length prefix or the
+/// payload exceeds kMaxPayload; the encoders below throw likewise.
+std::size_t request_size(const RequestContext& ctx);
+
+/// Appends a framed request.
+void encode_request(std::uint32_t id, const RequestContext& ctx, std::vector<std::uint8_t>& out);
+
+/// Writes a framed request into `out` without allocating. Returns the frame
+/// size, or 0 (writing nothing) if it does not fit in `capacity` bytes.
+std::size_t encode_request(std::uint32_t id, const RequestContext& ctx,
+                           std::uint8_t* out, std::size_t capacity);
+
+/// Decodes a request payload (without its header) into `ctx`, reusing its
+/// string storage. Attribute values that are not already interned decode to
+/// the empty Symbol, and tags whose key is not already interned are dropped,
+/// so untrusted clients cannot grow the symbol table; no policy can name
+/// such a value or key. Returns false for malformed payloads, in
+/// which case `id` is set if the payload was long enough to contain one.
+bool decode_request(const std::uint8_t* payload, std::size_t size,
+                    std::uint32_t& id, RequestContext& ctx);
+
+/// Appends a framed response.
+void encode_response(const Response& response, std::vector<std::uint8_t>& out);
+
+/// Writes a framed response (kResponseSize bytes) into `out`.
+void encode_response(const Response& response, std::uint8_t* out);
+
+/// Decodes a response payload (without its header).
+bool decode_response(const std::uint8_t* payload, std::size_t size, Response& out);
+
+} // namespace governance::wire
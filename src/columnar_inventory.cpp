@@ -0,0 +1,60 @@
+#include "governance/columnar_inventory.hpp"
+
+#include <algorithm>
+
+namespace governance {
+
+ColumnarInventory::ColumnarInventory(const std::vector<Resource>& resources) {
+    reserve(resources.size());
+    for (const auto& r : resources) append(r);
+}
+
+void ColumnarInventory::reserve(std::size_t rows) {
+    const std::size_t padded = (rows + kRowsPerWord - 1) / kRowsPerWord * kRowsPerWord;
+    ids_.reserve(rows);
+    types_.reserve(padded);
+    classifications_.reserve(padded);
+}
+
+void ColumnarInventory::append(const Resource& resource) {
+    const std::size_t row = ids_.size();
+    if (row % kRowsPerWord == 0) {
+        // Start a new word: pad the columns and extend every bitmap.
+        types_.resize(types_.size() + kRowsPerWord, 0);
+        classifications_.resize(classifications_.size() + kRowsPerWord, 0);
+        for (auto& column : tags_) column.present.push_back(0);
+    }
+    ids_.push_back(resource.id);
+    types_[row]           = resource.type.id();
+    classifications_[row] = resource.classification.id();
+
+    for (const auto& [key, value] : resource.tags) {
+        auto it = tag_index_.find(key.str());
+        if (it == tag_index_.end()) {
+            it = tag_index_.emplace(key.str(), tags_.size()).first;
+            tags_.push_back({ key.str(), std::vector<std::uint64_t>(words(), 0), {} });
+        }
+        TagColumn& column = tags_[it->second];
+        column.present[row / kRowsPerWord] |= std::uint64_t { 1 } << (row % kRowsPerWord);
+        column.values.emplace_back(row, value);
+    }
+}
+
+const std::uint64_t* ColumnarInventory::tag_bitmap(std::string_view key) const {
+    const auto it = tag_index_.find(std::string(key));
+    return it == tag_index_.end() ? nullptr : tags_[it->second].present.data();
+}
+
+Resource ColumnarInventory::row(std::size_t row) const {
+    Resource r { ids_[row], Symbol::from_id(types_[row]), Symbol::from_id(classifications_[row]), {} };
+    for (const auto& column : tags_) {
+        if (!(column.present[row / kRowsPerWord] >> (row % kRowsPerWord) & 1)) continue;
+        const auto it = std::lower_bound(
+            column.values.begin(), column.values.end(), row,
+            [](const std::pair<std::size_t, std::string>& v, std::size_t r) { return v.first < r; });
+        r.tags.set(column.key, it->second);
+    }
+    return r;
+}
+
+} // namespace governance
@@ -1,10 +1,31 @@
 #include "governance/compliance.hpp"
+#include "governance/columnar_inventory.hpp"
+#include "governance/inventory_snapshot.hpp"
+#include "governance/per_thread.hpp"
+#include "governance/thread_pool.hpp"
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
 
 namespace governance {
 
+// ── Violation ────────────────────────────────────────────────────────────────
+
+std::string Violation::str() const {
+    return "[" + name.str() + "] " + description.str();
+}
+
+std::ostream& operator<<(std::ostream& os, const Violation& violation) {
+    return os << '[' << violation.name << "] " << violation.description;
+}
+
 // ── ComplianceChecker ─────────────────────────────────────────────────────────
 
 void ComplianceChecker::add_rule(ComplianceRule rule) {
+    const auto index = static_cast<std::uint32_t>(rules_.size());
+    violations_.push_back({ index, rule.name, rule.description });
+    order_.push_back(index);
     rules_.push_back(std::move(rule));
 }
 
@@ -12,14 +33,320 @@ ComplianceReport ComplianceChecker::evaluate(const Resource& resource) const {
     ComplianceReport report;
     report.resource_id = resource.id;
 
-    for (const auto& rule : rules_) {
-        if (!rule.check(resource)) {
-            report.violations.push_back("[" + rule.name + "] " + rule.description);
-        }
+    for (std::size_t i = 0; i < rules_.size(); ++i) {
+        if (!rules_[i].check(resource)) report.violations.push_back(violations_[i]);
     }
     return report;
 }
 
+// ── Early exit ───────────────────────────────────────────────────────────────
+
+bool ComplianceChecker::is_compliant(const Resource& resource) const {
+    for (auto i : order_) {
+        if (!rules_[i].check(resource)) return false;
+    }
+    return true;
+}
+
+std::optional<Violation> ComplianceChecker::first_violation(const Resource& resource) const {
+    for (auto i : order_) {
+        if (!rules_[i].check(resource)) return violations_[i];
+    }
+    return std::nullopt;
+}
+
+std::size_t ComplianceChecker::count_violations(const Resource& resource) const {
+    std::size_t count = 0;
+    for (const auto& rule : rules_) count += rule.check(resource) ? 0 : 1;
+    return count;
+}
+
+void ComplianceChecker::order_rules() {
+    std::stable_sort(order_.begin(), order_.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return rules_[a].cost < rules_[b].cost;
+    });
+}
+
+void ComplianceChecker::order_rules(const ComplianceSummary& observed) {
+    if (observed.rules.size() != rules_.size())
+        throw std::invalid_argument("order_rules: summary does not match the checker's rules");
+    for (std::size_t i = 0; i < rules_.size(); ++i) {
+        if (observed.rules[i].rule_name != rules_[i].name)
+            throw std::invalid_argument("order_rules: summary does not match the checker's rules");
+    }
+
+    // Expected cost until the first failure is minimised by trying rules in
+    // ascending cost / P(fail). Compare cross-multiplied so that rules with
+    // no observed failures sort last without dividing by zero.
+    std::stable_sort(order_.begin(), order_.end(), [&](std::uint32_t a, std::uint32_t b) {
+        const double fails_a = static_cast<double>(observed.rules[a].violations);
+        const double fails_b = static_cast<double>(observed.rules[b].violations);
+        if (fails_a == 0 || fails_b == 0) {
+            if ((fails_a == 0) != (fails_b == 0)) return fails_b == 0;
+            return rules_[a].cost < rules_[b].cost;
+        }
+        return rules_[a].cost * fails_b < rules_[b].cost * fails_a;
+    });
+}
+
+// ── Parallel scan ────────────────────────────────────────────────────────────
+
+template <typename Fn>
+void ComplianceChecker::for_each_chunk(std::size_t count, Fn&& fn) const {
+    if (!pool_ || pool_->concurrency() == 1) {
+        fn(0, count);
+        return;
+    }
+    // Threads claim chunks from a shared cursor, so a chunk of slow resources
+    // does not hold up the others; several chunks per thread keep that
+    // balancing effective, 64 resources per chunk keep claiming cheap.
+    const std::size_t chunk = std::max<std::size_t>(64, count / (pool_->concurrency() * 8));
+    pool_->parallel_for(count, chunk, fn);
+}
+
+void ComplianceChecker::scan(const Resource* resources, std::size_t count,
+                             ComplianceReport* reports) const {
+    for_each_chunk(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) reports[i] = evaluate(resources[i]);
+    });
+}
+
+std::vector<ComplianceReport> ComplianceChecker::scan(const std::vector<Resource>& resources) const {
+    std::vector<ComplianceReport> reports(resources.size());
+    scan(resources.data(), resources.size(), reports.data());
+    return reports;
+}
+
+void ComplianceChecker::scan(const Resource* resources, std::size_t count,
+                             const ReportSink& sink) const {
+    const std::size_t window = kScanWindow * concurrency();
+    std::vector<ComplianceReport> reports(std::min(window, count));
+    for (std::size_t base = 0; base < count; base += window) {
+        const std::size_t n = std::min(window, count - base);
+        scan(resources + base, n, reports.data());
+        for (std::size_t i = 0; i < n; ++i) sink(base + i, std::move(reports[i]));
+    }
+}
+
+void ComplianceChecker::scan(const std::vector<Resource>& resources, const ReportSink& sink) const {
+    scan(resources.data(), resources.size(), sink);
+}
+
+void ComplianceChecker::scan(const InventorySnapshot& snapshot, const ReportSink& sink) const {
+    const std::size_t count  = snapshot.size();
+    const std::size_t window = kScanWindow * concurrency();
+    std::vector<ComplianceReport> reports(std::min(window, count));
+    PerThread<Resource> scratch([] { return std::make_unique<Resource>(); });
+    for (std::size_t base = 0; base < count; base += window) {
+        const std::size_t n = std::min(window, count - base);
+        for_each_chunk(n, [&](std::size_t begin, std::size_t end) {
+            Resource& resource = scratch.local();
+            for (std::size_t i = begin; i < end; ++i) {
+                snapshot.read(base + i, resource);
+                reports[i] = evaluate(resource);
+            }
+        });
+        for (std::size_t i = 0; i < n; ++i) sink(base + i, std::move(reports[i]));
+    }
+}
+
+// ── Summaries ────────────────────────────────────────────────────────────────
+
+namespace {
+
+// One thread's share of a summarize() run. Written only by its thread and
+// read after parallel_for() has joined, so plain integers suffice.
+struct SummaryAccumulator {
+    std::vector<std::uint64_t> violations;      // per rule
+    std::vector<std::size_t>   non_compliant;   // input indices, ascending per chunk
+    Resource                   scratch;         // for rows decoded on the fly
+};
+
+} // namespace
+
+template <typename Row, typename Id>
+ComplianceSummary ComplianceChecker::summarize_rows(std::size_t count, Row&& row, Id&& id) const {
+    const std::size_t rules = rules_.size();
+    PerThread<SummaryAccumulator> accumulators([rules] {
+        auto acc = std::make_unique<SummaryAccumulator>();
+        acc->violations.assign(rules, 0);
+        return acc;
+    });
+
+    for_each_chunk(count, [&](std::size_t begin, std::size_t end) {
+        SummaryAccumulator& acc = accumulators.local();
+        for (std::size_t i = begin; i < end; ++i) {
+            const Resource& resource = row(i, acc.scratch);
+            bool violated = false;
+            for (std::size_t r = 0; r < rules; ++r) {
+                if (!rules_[r].check(resource)) {
+                    ++acc.violations[r];
+                    violated = true;
+                }
+            }
+            if (violated) acc.non_compliant.push_back(i);
+        }
+    });
+
+    ComplianceSummary summary;
+    summary.resources = count;
+    summary.rules.reserve(rules);
+    for (const auto& rule : rules_) summary.rules.push_back({ rule.name, 0 });
+
+    std::vector<std::size_t> non_compliant;
+    accumulators.for_each([&](const SummaryAccumulator& acc) {
+        for (std::size_t r = 0; r < rules; ++r) summary.rules[r].violations += acc.violations[r];
+        non_compliant.insert(non_compliant.end(), acc.non_compliant.begin(), acc.non_compliant.end());
+    });
+    std::sort(non_compliant.begin(), non_compliant.end());
+
+    summary.non_compliant.reserve(non_compliant.size());
+    for (auto i : non_compliant) summary.non_compliant.emplace_back(id(i));
+    return summary;
+}
+
+ComplianceSummary ComplianceChecker::summarize(const Resource* resources, std::size_t count) const {
+    return summarize_rows(
+        count, [resources](std::size_t i, Resource&) -> const Resource& { return resources[i]; },
+        [resources](std::size_t i) -> const std::string& { return resources[i].id; });
+}
+
+ComplianceSummary ComplianceChecker::summarize(const std::vector<Resource>& resources) const {
+    return summarize(resources.data(), resources.size());
+}
+
+ComplianceSummary ComplianceChecker::summarize(const InventorySnapshot& snapshot) const {
+    return summarize_rows(
+        snapshot.size(),
+        [&snapshot](std::size_t i, Resource& scratch) -> const Resource& {
+            snapshot.read(i, scratch);
+            return scratch;
+        },
+        [&snapshot](std::size_t i) { return snapshot.id(i); });
+}
+
+namespace {
+
+// Words per kernel call: 4096 rows keep each rule's failure bits and the
+// columns it reads in cache between rules.
+constexpr std::size_t kBlockWords = 64;
+
+unsigned popcount(std::uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_popcountll(v));
+#else
+    unsigned count = 0;
+    for (; v; v &= v - 1) ++count;
+    return count;
+#endif
+}
+
+unsigned lowest_bit(std::uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(v));
+#else
+    unsigned bit = 0;
+    while (!(v & 1)) {
+        v >>= 1;
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+struct ColumnAccumulator {
+    std::vector<std::uint64_t> violations;   // per rule
+    std::vector<std::uint64_t> failed;       // one block of one rule's failure bits
+    std::vector<Resource>      rows;         // one block, for rules without a kernel
+};
+
+} // namespace
+
+ComplianceSummary ComplianceChecker::summarize(const ColumnarInventory& inventory) const {
+    const std::size_t rules = rules_.size();
+    const std::size_t words = inventory.words();
+    const bool needs_rows = std::any_of(rules_.begin(), rules_.end(),
+                                        [](const ComplianceRule& r) { return !r.column_check; });
+    const std::size_t tail = inventory.size() % ColumnarInventory::kRowsPerWord;
+    const std::uint64_t last_mask = tail ? (std::uint64_t { 1 } << tail) - 1 : ~std::uint64_t { 0 };
+
+    // Failures of any rule, by row; chunks write disjoint words.
+    std::vector<std::uint64_t> non_compliant(words, 0);
+    PerThread<ColumnAccumulator> accumulators([rules] {
+        auto acc = std::make_unique<ColumnAccumulator>();
+        acc->violations.assign(rules, 0);
+        acc->failed.resize(kBlockWords);
+        return acc;
+    });
+
+    for_each_chunk(words, [&](std::size_t chunk_begin, std::size_t chunk_end) {
+        ColumnAccumulator& acc = accumulators.local();
+        for (std::size_t begin = chunk_begin; begin < chunk_end; begin += kBlockWords) {
+            const std::size_t end   = std::min(begin + kBlockWords, chunk_end);
+            const std::size_t first = begin * ColumnarInventory::kRowsPerWord;
+            const std::size_t last  = std::min(end * ColumnarInventory::kRowsPerWord, inventory.size());
+            if (needs_rows) {
+                acc.rows.clear();
+                for (std::size_t row = first; row < last; ++row) acc.rows.push_back(inventory.row(row));
+            }
+
+            for (std::size_t r = 0; r < rules; ++r) {
+                const ComplianceRule& rule = rules_[r];
+                std::uint64_t* failed = acc.failed.data();
+                if (rule.column_check) {
+                    rule.column_check(inventory, begin, end, failed);
+                } else {
+                    std::fill(failed, failed + (end - begin), 0);
+                    for (std::size_t row = first; row < last; ++row) {
+                        if (!rule.check(acc.rows[row - first]))
+                            failed[row / ColumnarInventory::kRowsPerWord - begin] |=
+                                std::uint64_t { 1 } << (row % ColumnarInventory::kRowsPerWord);
+                    }
+                }
+                if (end == words) failed[end - 1 - begin] &= last_mask;
+
+                std::uint64_t count = 0;
+                for (std::size_t w = 0; w < end - begin; ++w) {
+                    count += popcount(failed[w]);
+                    non_compliant[begin + w] |= failed[w];
+                }
+                acc.violations[r] += count;
+            }
+        }
+    });
+
+    ComplianceSummary summary;
+    summary.resources = inventory.size();
+    summary.rules.reserve(rules);
+    for (const auto& rule : rules_) summary.rules.push_back({ rule.name, 0 });
+    accumulators.for_each([&](const ColumnAccumulator& acc) {
+        for (std::size_t r = 0; r < rules; ++r) summary.rules[r].violations += acc.violations[r];
+    });
+
+    std::size_t failing = 0;
+    for (auto bits : non_compliant) failing += popcount(bits);
+    summary.non_compliant.reserve(failing);
+    for (std::size_t w = 0; w < words; ++w) {
+        for (std::uint64_t bits = non_compliant[w]; bits; bits &= bits - 1) {
+            summary.non_compliant.push_back(
+                inventory.id(w * ColumnarInventory::kRowsPerWord + lowest_bit(bits)));
+        }
+    }
+    return summary;
+}
+
+void ComplianceChecker::set_concurrency(std::size_t threads) {
+    if (threads == 1) {
+        pool_.reset();
+        return;
+    }
+    pool_ = std::make_shared<ThreadPool>(threads);
+}
+
+std::size_t ComplianceChecker::concurrency() const {
+    return pool_ ? pool_->concurrency() : 1;
+}
+
 // ── Default rules ─────────────────────────────────────────────────────────────
 
 ComplianceChecker default_compliance_checker() {
@@ -30,9 +357,16 @@ ComplianceChecker default_compliance_checker() {
         "1.0",
         "governance-team",
         "Resource must have an 'owner' tag.",
-        [](const Resource& r) {
-            return r.tags.count("owner") > 0;
-        }
+        [owner = Symbol("owner")](const Resource& r) {
+            return r.tags.contains(owner);
+        },
+        2,  // a short scan of the tags; the others compare interned symbols
+        [](const ColumnarInventory& inv, std::size_t first, std::size_t last, std::uint64_t* failed) {
+            const std::uint64_t* owner = inv.tag_bitmap("owner");
+            for (std::size_t w = first; w < last; ++w)
+                failed[w - first] = owner ? ~owner[w] : ~std::uint64_t { 0 };
+        },
+        { Attribute::Tags }, { "owner" }
     });
 
     checker.add_rule({
@@ -41,8 +375,17 @@ ComplianceChecker default_compliance_checker() {
         "governance-team",
         "Resources of type 'secret' must not be classified as 'public'.",
         [](const Resource& r) {
-            return !(r.type == "secret" && r.classification == "public");
-        }
+            return !(r.type == symbols::type_secret && r.classification == symbols::class_public);
+        },
+        1,
+        [](const ColumnarInventory& inv, std::size_t first, std::size_t last, std::uint64_t* failed) {
+            const std::uint32_t* type = inv.types();
+            const std::uint32_t* cls  = inv.classifications();
+            pack_rows(first, last, failed, [&](std::size_t r) {
+                return (type[r] == symbols::type_secret.id()) & (cls[r] == symbols::class_public.id());
+            });
+        },
+        { Attribute::ResourceType, Attribute::Classification }, {}
     });
 
     checker.add_rule({
@@ -51,10 +394,21 @@ ComplianceChecker default_compliance_checker() {
         "governance-team",
         "Database resources must be classified as 'restricted' or 'confidential'.",
         [](const Resource& r) {
-            if (r.type != "database") return true;
-            return r.classification == "restricted" ||
-                   r.classification == "confidential";
-        }
+            if (r.type != symbols::type_database) return true;
+            return r.classification == symbols::class_restricted ||
+                   r.classification == symbols::class_confidential;
+        },
+        1,
+        [](const ColumnarInventory& inv, std::size_t first, std::size_t last, std::uint64_t* failed) {
+            const std::uint32_t* type = inv.types();
+            const std::uint32_t* cls  = inv.classifications();
+            pack_rows(first, last, failed, [&](std::size_t r) {
+                return (type[r] == symbols::type_database.id()) &
+                       (cls[r] != symbols::class_restricted.id()) &
+                       (cls[r] != symbols::class_confidential.id());
+            });
+        },
+        { Attribute::ResourceType, Attribute::Classification }, {}
     });
 
     checker.add_rule({
@@ -64,7 +418,13 @@ ComplianceChecker default_compliance_checker() {
         "Every resource must have a non-empty classification.",
         [](const Resource& r) {
             return !r.classification.empty();
-        }
+        },
+        1,
+        [](const ColumnarInventory& inv, std::size_t first, std::size_t last, std::uint64_t* failed) {
+            const std::uint32_t* cls = inv.classifications();
+            pack_rows(first, last, failed, [&](std::size_t r) { return cls[r] == 0; });
+        },
+        { Attribute::Classification }, {}
     });
 
     return checker;
@@ -0,0 +1,140 @@
+#include "governance/decision_cache.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace governance {
+
+// ── DecisionKey ──────────────────────────────────────────────────────────────
+
+DecisionKey DecisionKey::from(const RequestContext& ctx, AttributeSet attrs) {
+    DecisionKey k;
+    if (attrs.contains(Attribute::Role))           k.role           = ctx.principal.role.id();
+    if (attrs.contains(Attribute::ResourceType))   k.resource_type  = ctx.resource.type.id();
+    if (attrs.contains(Attribute::Classification)) k.classification = ctx.resource.classification.id();
+    if (attrs.contains(Attribute::Verb))           k.verb           = ctx.action.verb.id();
+    if (attrs.contains(Attribute::Environment))    k.environment    = ctx.environment.id();
+    if (attrs.contains(Attribute::Mfa))            k.mfa_verified   = ctx.mfa_verified;
+    return k;
+}
+
+std::size_t DecisionKeyHash::operator()(const DecisionKey& k) const noexcept {
+    // 64-bit FNV-1a over the key fields.
+    std::uint64_t h = 1469598103934665603ull;
+    auto mix = [&h](std::uint64_t v) {
+        h ^= v;
+        h *= 1099511628211ull;
+    };
+    mix(k.role);
+    mix(k.resource_type);
+    mix(k.classification);
+    mix(k.verb);
+    mix(k.environment);
+    mix(k.mfa_verified ? 1 : 0);
+    return static_cast<std::size_t>(h ^ (h >> 32));
+}
+
+// ── DecisionCache ────────────────────────────────────────────────────────────
+
+void DecisionCache::Shard::reserve(std::size_t capacity) {
+    slots.resize(capacity);
+    index.reserve(capacity);
+    stats.capacity = capacity;
+}
+
+const DecisionCache::Slot* DecisionCache::Shard::find(const DecisionKey& key) {
+    auto it = index.find(key);
+    if (it == index.end()) {
+        ++stats.misses;
+        return nullptr;
+    }
+    ++stats.hits;
+    Slot& slot = slots[it->second];
+    slot.referenced = true;
+    return &slot;
+}
+
+void DecisionCache::Shard::insert(const DecisionKey& key, CachedDecision value) {
+    auto it = index.find(key);
+    if (it != index.end()) {
+        slots[it->second].value = std::move(value);
+        return;
+    }
+
+    std::size_t victim;
+    if (used < slots.size()) {
+        victim = used++;
+    } else {
+        while (slots[hand].referenced) {
+            slots[hand].referenced = false;
+            hand = (hand + 1) % slots.size();
+        }
+        victim = hand;
+        hand   = (hand + 1) % slots.size();
+        index.erase(slots[victim].key);
+        ++stats.evictions;
+    }
+
+    slots[victim] = Slot{ key, std::move(value), false };
+    index.emplace(key, victim);
+}
+
+DecisionCache::DecisionCache(std::size_t capacity, std::size_t shards) {
+    capacity = std::max<std::size_t>(capacity, 1);
+    if (shards == kShardPerCore) shards = std::max(1u, std::thread::hardware_concurrency());
+    shards = std::min(shards, std::max<std::size_t>(1, capacity / kMinShardCapacity));
+    while (shard_count_ * 2 <= shards) {
+        shard_count_ *= 2;
+        ++shard_bits_;
+    }
+    shard_capacity_ = (capacity + shard_count_ - 1) / shard_count_;
+
+    shards_.reset(new Shard[shard_count_]);
+    for (std::size_t i = 0; i < shard_count_; ++i) shards_[i].reserve(shard_capacity_);
+}
+
+bool DecisionCache::lookup(const DecisionKey& key, CachedDecision& out) {
+    return visit(key, [&](const CachedDecision& value) { out = value; });
+}
+
+std::optional<Effect> DecisionCache::lookup_effect(const DecisionKey& key) {
+    Shard& shard = shard_for(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const Slot* slot = shard.find(key);
+    if (!slot) return std::nullopt;
+    return slot->value.decision.effect;
+}
+
+void DecisionCache::insert(const DecisionKey& key, CachedDecision value) {
+    Shard& shard = shard_for(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.insert(key, std::move(value));
+}
+
+std::shared_ptr<DecisionCache> DecisionCache::invalidated() const {
+    auto fresh = std::make_shared<DecisionCache>(capacity(), shard_count_);
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        fresh->shards_[i].stats      = shards_[i].stats;
+        fresh->shards_[i].stats.size = 0;
+    }
+    ++fresh->shards_[0].stats.invalidations;
+    return fresh;
+}
+
+CacheStats DecisionCache::stats() const {
+    CacheStats total;
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        const auto& s = shards_[i].stats;
+        total.hits          += s.hits;
+        total.misses        += s.misses;
+        total.evictions     += s.evictions;
+        total.invalidations += s.invalidations;
+        total.size          += shards_[i].used;
+        total.capacity      += s.capacity;
+    }
+    return total;
+}
+
+} // namespace governance
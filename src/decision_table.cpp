@@ -0,0 +1,163 @@
+#include "governance/decision_table.hpp"
+
+#include <stdexcept>
+
+namespace governance {
+
+namespace {
+
+bool same_decision(const PolicyDecision& a, const PolicyDecision& b) {
+    return a.effect == b.effect && a.policy_name == b.policy_name && a.reason == b.reason;
+}
+
+} // namespace
+
+// ── Dimensions ───────────────────────────────────────────────────────────────
+//
+// The Mfa dimension reuses Symbol ids 0 and 1 as false/true coordinates.
+
+std::uint32_t DecisionTable::coordinate_id(const RequestContext& ctx, std::size_t dim) {
+    switch (dim) {
+        case Role:           return ctx.principal.role.id();
+        case ResourceType:   return ctx.resource.type.id();
+        case Classification: return ctx.resource.classification.id();
+        case Verb:           return ctx.action.verb.id();
+        case Environment:    return ctx.environment.id();
+        default:             return ctx.mfa_verified ? 1 : 0;
+    }
+}
+
+void DecisionTable::set_coordinate(RequestContext& ctx, std::size_t dim, Symbol value) {
+    switch (dim) {
+        case Role:           ctx.principal.role          = value; break;
+        case ResourceType:   ctx.resource.type           = value; break;
+        case Classification: ctx.resource.classification = value; break;
+        case Verb:           ctx.action.verb             = value; break;
+        case Environment:    ctx.environment             = value; break;
+        default:             ctx.mfa_verified            = value.id() != 0; break;
+    }
+}
+
+// ── Domain ───────────────────────────────────────────────────────────────────
+
+DecisionTable::Domain DecisionTable::Domain::well_known() {
+    using namespace symbols;
+    return {
+        { role_admin, role_engineer, role_analyst, role_guest },
+        { type_database, type_storage, type_compute, type_secret },
+        { class_public, class_internal, class_confidential, class_restricted },
+        { verb_read, verb_write, verb_delete, verb_execute },
+        { env_production, env_staging, env_dev },
+    };
+}
+
+// ── Compilation ──────────────────────────────────────────────────────────────
+
+DecisionTable DecisionTable::compile(PolicyEngine engine, Domain domain) {
+    if (!engine.cacheable()) {
+        throw std::invalid_argument(
+            "DecisionTable: every policy must declare cacheable reads to be compiled");
+    }
+
+    DecisionTable table;
+    const AttributeSet reads = engine.reads();
+    const Attribute attr_of[DimCount] = {
+        Attribute::Role, Attribute::ResourceType, Attribute::Classification,
+        Attribute::Verb, Attribute::Environment, Attribute::Mfa,
+    };
+    std::vector<Symbol>* values_of[DimCount - 1] = {
+        &domain.roles, &domain.resource_types, &domain.classifications,
+        &domain.verbs, &domain.environments,
+    };
+
+    std::size_t cells = 1;
+    for (std::size_t d = 0; d < DimCount; ++d) {
+        Dimension& dim = table.dims_[d];
+        if (!reads.contains(attr_of[d])) continue;
+
+        dim.values = d == Mfa ? std::vector<Symbol>{ Symbol::from_id(0), Symbol::from_id(1) }
+                              : *values_of[d];
+        if (dim.values.empty() || dim.values.size() >= kAbsent) {
+            throw std::invalid_argument("DecisionTable: each read dimension needs 1-254 values");
+        }
+        for (std::size_t i = 0; i < dim.values.size(); ++i) {
+            const auto id = dim.values[i].id();
+            if (id >= dim.index_of.size()) dim.index_of.resize(id + 1, kAbsent);
+            dim.index_of[id] = static_cast<std::uint8_t>(i);
+        }
+        dim.size   = dim.values.size();
+        dim.stride = cells;
+        cells     *= dim.size;
+    }
+
+    // The copy shares the caller's decision cache. Detach it, so compiling
+    // does not fill that cache and verify() re-runs the policies rather than
+    // reading back what compile() stored.
+    table.engine_ = std::move(engine);
+    table.engine_.disable_cache();
+    table.effects_.resize(cells);
+    table.decision_of_.resize(cells);
+
+    for (std::size_t cell = 0; cell < cells; ++cell) {
+        const auto decision = table.engine_.evaluate(table.context_for(cell)).decision;
+
+        std::size_t id = 0;
+        while (id < table.decisions_.size() && !same_decision(table.decisions_[id], decision)) ++id;
+        if (id == table.decisions_.size()) {
+            if (id > UINT16_MAX) throw std::length_error("DecisionTable: too many distinct decisions");
+            table.decisions_.push_back(decision);
+        }
+
+        table.effects_[cell]     = decision.effect;
+        table.decision_of_[cell] = static_cast<std::uint16_t>(id);
+    }
+    return table;
+}
+
+RequestContext DecisionTable::context_for(std::size_t cell) const {
+    RequestContext ctx;
+    for (std::size_t d = 0; d < DimCount; ++d) {
+        const Dimension& dim = dims_[d];
+        if (!dim.stride) continue;
+        set_coordinate(ctx, d, dim.values[(cell / dim.stride) % dim.size]);
+    }
+    return ctx;
+}
+
+// ── Lookup ───────────────────────────────────────────────────────────────────
+
+std::optional<std::size_t> DecisionTable::cell_of(const RequestContext& ctx) const {
+    std::size_t cell = 0;
+    for (std::size_t d = 0; d < DimCount; ++d) {
+        const Dimension& dim = dims_[d];
+        if (!dim.stride) continue;
+        const auto id = coordinate_id(ctx, d);
+        if (id >= dim.index_of.size() || dim.index_of[id] == kAbsent) return std::nullopt;
+        cell += dim.index_of[id] * dim.stride;
+    }
+    return cell;
+}
+
+Effect DecisionTable::decide(const RequestContext& ctx) const {
+    if (auto cell = cell_of(ctx)) return effects_[*cell];
+    return engine_.decide(ctx);
+}
+
+PolicyDecision DecisionTable::decision(const RequestContext& ctx) const {
+    if (auto cell = cell_of(ctx)) return decisions_[decision_of_[*cell]];
+    return engine_.evaluate(ctx).decision;
+}
+
+// ── Verification ─────────────────────────────────────────────────────────────
+
+std::size_t DecisionTable::verify() const {
+    std::size_t mismatches = 0;
+    for (std::size_t cell = 0; cell < effects_.size(); ++cell) {
+        const auto expected = engine_.evaluate(context_for(cell)).decision;
+        const auto& stored  = decisions_[decision_of_[cell]];
+        if (effects_[cell] != expected.effect || !same_decision(stored, expected)) ++mismatches;
+    }
+    return mismatches;
+}
+
+} // namespace governance
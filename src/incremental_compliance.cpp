@@ -0,0 +1,131 @@
+#include "governance/incremental_compliance.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace governance {
+
+// ── ResourceDelta ────────────────────────────────────────────────────────────
+
+ResourceDelta ResourceDelta::between(const Resource& before, const Resource& after) {
+    ResourceDelta delta;
+    delta.id = after.id;
+    if (before.type != after.type) delta.type = after.type;
+    if (before.classification != after.classification) delta.classification = after.classification;
+    for (const auto& [key, value] : after.tags) {
+        const auto it = before.tags.find(key);
+        if (it == before.tags.end() || it->value != value) delta.tags.emplace_back(key, std::string(value));
+    }
+    for (const auto& tag : before.tags) {
+        if (!after.tags.contains(tag.key)) delta.tags.emplace_back(tag.key, std::nullopt);
+    }
+    return delta;
+}
+
+// ── IncrementalComplianceChecker ─────────────────────────────────────────────
+
+IncrementalComplianceChecker::IncrementalComplianceChecker(ComplianceChecker checker)
+    : checker_(std::move(checker)), stamps_(checker_.rule_count(), 0) {
+    const auto& rules = checker_.rules();
+    for (std::uint32_t i = 0; i < rules.size(); ++i) {
+        const ComplianceRule& rule = rules[i];
+        if (rule.reads.contains(Attribute::ResourceType))   type_rules_.push_back(i);
+        if (rule.reads.contains(Attribute::Classification)) classification_rules_.push_back(i);
+        if (rule.reads.contains(Attribute::Tags)) {
+            if (rule.tag_keys.empty()) {
+                any_tag_rules_.push_back(i);
+            } else {
+                for (const auto& key : rule.tag_keys) tag_rules_[Symbol(key)].push_back(i);
+            }
+        }
+        // Ids never change under a delta, so ResourceId needs no index.
+    }
+}
+
+const ComplianceReport& IncrementalComplianceChecker::upsert(const Resource& resource) {
+    auto it = entries_.find(resource.id);
+    if (it != entries_.end()) return apply(ResourceDelta::between(it->second.resource, resource));
+
+    Entry& entry = entries_[resource.id];
+    entry.resource = resource;
+    entry.report   = checker_.evaluate(resource);
+    rule_evaluations_ += checker_.rule_count();
+    return entry.report;
+}
+
+const ComplianceReport& IncrementalComplianceChecker::apply(const ResourceDelta& delta) {
+    const auto it = entries_.find(delta.id);
+    if (it == entries_.end()) throw std::out_of_range("IncrementalComplianceChecker: unknown resource " + delta.id);
+    Entry&    entry    = it->second;
+    Resource& resource = entry.resource;
+
+    ++stamp_;
+    marked_.clear();
+    if (delta.type && *delta.type != resource.type) {
+        resource.type = *delta.type;
+        mark(type_rules_);
+    }
+    if (delta.classification && *delta.classification != resource.classification) {
+        resource.classification = *delta.classification;
+        mark(classification_rules_);
+    }
+    for (const auto& [key, value] : delta.tags) {
+        const auto tag = resource.tags.find(key);
+        if (value) {
+            if (tag != resource.tags.end() && tag->value == *value) continue;
+            resource.tags.set(key, *value);
+        } else {
+            if (tag == resource.tags.end()) continue;
+            resource.tags.erase(key);
+        }
+        mark_tag(key);
+    }
+
+    rerun_marked(entry);
+    return entry.report;
+}
+
+bool IncrementalComplianceChecker::erase(const std::string& id) {
+    return entries_.erase(id) > 0;
+}
+
+const Resource* IncrementalComplianceChecker::resource(const std::string& id) const {
+    const auto it = entries_.find(id);
+    return it == entries_.end() ? nullptr : &it->second.resource;
+}
+
+const ComplianceReport* IncrementalComplianceChecker::report(const std::string& id) const {
+    const auto it = entries_.find(id);
+    return it == entries_.end() ? nullptr : &it->second.report;
+}
+
+void IncrementalComplianceChecker::mark(const std::vector<std::uint32_t>& rules) {
+    for (auto r : rules) {
+        if (stamps_[r] == stamp_) continue;
+        stamps_[r] = stamp_;
+        marked_.push_back(r);
+    }
+}
+
+void IncrementalComplianceChecker::mark_tag(Symbol key) {
+    mark(any_tag_rules_);
+    const auto it = tag_rules_.find(key);
+    if (it != tag_rules_.end()) mark(it->second);
+}
+
+void IncrementalComplianceChecker::rerun_marked(Entry& entry) {
+    auto& violations = entry.report.violations;
+    for (auto r : marked_) {
+        const bool failed = !checker_.rules()[r].check(entry.resource);
+        ++rule_evaluations_;
+
+        // Violations stay sorted by rule index, as evaluate() reports them.
+        const auto pos = std::lower_bound(violations.begin(), violations.end(), r,
+                                          [](const Violation& v, std::uint32_t rule) { return v.rule < rule; });
+        const bool present = pos != violations.end() && pos->rule == r;
+        if (failed && !present)  violations.insert(pos, checker_.violation(r));
+        if (!failed && present)  violations.erase(pos);
+    }
+}
+
+} // namespace governance
@@ -0,0 +1,316 @@
+#include "governance/inventory_snapshot.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+namespace governance {
+
+static_assert(sizeof(snapshot::Header) == 80, "snapshot::Header must have no padding");
+static_assert(sizeof(snapshot::String) == 8, "snapshot::String must have no padding");
+static_assert(sizeof(snapshot::Record) == 24, "snapshot::Record must have no padding");
+static_assert(sizeof(snapshot::Tag) == 12, "snapshot::Tag must have no padding");
+
+namespace {
+
+constexpr std::uint64_t align8(std::uint64_t n) { return (n + 7) & ~std::uint64_t { 7 }; }
+
+[[noreturn]] void invalid(const std::string& what) {
+    throw std::invalid_argument("InventorySnapshot: " + what);
+}
+
+// ── Mapping ──────────────────────────────────────────────────────────────────
+//
+// Where mmap is available the file is mapped read-only; elsewhere it is read
+// into an aligned buffer, which is correct but pays for the whole file.
+
+#if defined(__unix__) || defined(__APPLE__)
+
+[[noreturn]] void throw_errno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+void* map_file(const std::string& path, std::size_t& size) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) throw_errno("open");
+    struct stat st {};
+    if (::fstat(fd, &st) < 0) {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), "fstat");
+    }
+    size = static_cast<std::size_t>(st.st_size);
+    if (size < sizeof(snapshot::Header)) {
+        ::close(fd);
+        invalid("file too small");
+    }
+    void* p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    const int error = errno;
+    ::close(fd);   // the mapping keeps the file open
+    if (p == MAP_FAILED) throw std::system_error(error, std::generic_category(), "mmap");
+    return p;
+}
+
+void unmap_file(void* mapping, std::size_t size) {
+    ::munmap(mapping, size);
+}
+
+#else
+
+void* map_file(const std::string& path, std::size_t& size) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory), "open");
+    size = static_cast<std::size_t>(in.tellg());
+    if (size < sizeof(snapshot::Header)) invalid("file too small");
+    auto* buffer = new std::uint64_t[(size + 7) / 8];
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(size))) {
+        delete[] buffer;
+        throw std::system_error(std::make_error_code(std::errc::io_error), "read");
+    }
+    return buffer;
+}
+
+void unmap_file(void* mapping, std::size_t) {
+    delete[] static_cast<std::uint64_t*>(mapping);
+}
+
+#endif
+
+} // namespace
+
+// ── InventorySnapshot ────────────────────────────────────────────────────────
+
+InventorySnapshot InventorySnapshot::open(const std::string& path) {
+    InventorySnapshot s;
+    s.mapping_ = map_file(path, s.size_);
+    s.attach(s.mapping_, s.size_);   // on a throw, ~InventorySnapshot unmaps
+    return s;
+}
+
+InventorySnapshot InventorySnapshot::view(const void* data, std::size_t size) {
+    InventorySnapshot s;
+    s.attach(data, size);
+    return s;
+}
+
+InventorySnapshot::InventorySnapshot(InventorySnapshot&& other) noexcept
+    : base_(std::exchange(other.base_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      mapping_(std::exchange(other.mapping_, nullptr)),
+      records_(std::exchange(other.records_, nullptr)),
+      tags_(std::exchange(other.tags_, nullptr)),
+      strings_(std::exchange(other.strings_, nullptr)),
+      resource_count_(std::exchange(other.resource_count_, 0)),
+      tag_count_(std::exchange(other.tag_count_, 0)),
+      strings_size_(std::exchange(other.strings_size_, 0)),
+      vocabulary_(std::move(other.vocabulary_)) {}
+
+InventorySnapshot& InventorySnapshot::operator=(InventorySnapshot&& other) noexcept {
+    if (this != &other) {
+        this->~InventorySnapshot();
+        new (this) InventorySnapshot(std::move(other));
+    }
+    return *this;
+}
+
+InventorySnapshot::~InventorySnapshot() {
+    if (mapping_) unmap_file(mapping_, size_);
+}
+
+void InventorySnapshot::attach(const void* data, std::size_t size) {
+    base_ = static_cast<const std::uint8_t*>(data);
+    size_ = size;
+    if (size < sizeof(snapshot::Header)) invalid("file too small");
+    if (reinterpret_cast<std::uintptr_t>(data) % 8 != 0) invalid("data not 8-byte aligned");
+
+    const auto& h = *reinterpret_cast<const snapshot::Header*>(base_);
+    if (h.magic != snapshot::kMagic) invalid("not a snapshot, or written with another byte order");
+    if (h.version != snapshot::kVersion) invalid("unsupported version " + std::to_string(h.version));
+    if (h.file_size != size) invalid("file size does not match the header (truncated?)");
+
+    // Each section must lie inside the file; the counts are divided rather
+    // than multiplied so a hostile header cannot overflow the check.
+    const auto section = [&](std::uint64_t offset, std::uint64_t count, std::size_t width, const char* name) {
+        if (offset % 8 != 0 || offset < sizeof(snapshot::Header) || offset > size ||
+            count > (size - offset) / width) {
+            invalid(std::string(name) + " section out of bounds");
+        }
+    };
+    section(h.vocabulary_offset, h.vocabulary_count, sizeof(snapshot::String), "vocabulary");
+    section(h.records_offset, h.resource_count, sizeof(snapshot::Record), "records");
+    section(h.tags_offset, h.tag_count, sizeof(snapshot::Tag), "tags");
+    section(h.strings_offset, h.strings_size, 1, "strings");
+
+    records_        = reinterpret_cast<const snapshot::Record*>(base_ + h.records_offset);
+    tags_           = reinterpret_cast<const snapshot::Tag*>(base_ + h.tags_offset);
+    strings_        = reinterpret_cast<const char*>(base_ + h.strings_offset);
+    resource_count_ = static_cast<std::size_t>(h.resource_count);
+    tag_count_      = static_cast<std::size_t>(h.tag_count);
+    strings_size_   = static_cast<std::size_t>(h.strings_size);
+
+    // The vocabulary is small (types, classifications, tag keys), so it is
+    // interned up front and records resolve their words by index.
+    const auto* words = reinterpret_cast<const snapshot::String*>(base_ + h.vocabulary_offset);
+    if (h.vocabulary_count == 0 || words[0].size != 0) invalid("vocabulary entry 0 must be empty");
+    if (h.vocabulary_count > snapshot::kMaxVocabulary) {
+        invalid("vocabulary of " + std::to_string(h.vocabulary_count) + " entries exceeds the limit of " +
+                std::to_string(snapshot::kMaxVocabulary));
+    }
+    vocabulary_.reserve(h.vocabulary_count);
+    for (std::uint32_t i = 0; i < h.vocabulary_count; ++i) {
+        if (std::uint64_t { words[i].offset } + words[i].size > strings_size_) {
+            invalid("vocabulary entry " + std::to_string(i) + " out of bounds");
+        }
+        vocabulary_.emplace_back(std::string_view(strings_ + words[i].offset, words[i].size));
+    }
+}
+
+std::string_view InventorySnapshot::string(const snapshot::String& s, std::size_t record) const {
+    if (std::uint64_t { s.offset } + s.size > strings_size_) {
+        invalid("record " + std::to_string(record) + ": string out of bounds");
+    }
+    return { strings_ + s.offset, s.size };
+}
+
+Symbol InventorySnapshot::word(std::uint32_t index, std::size_t record) const {
+    if (index >= vocabulary_.size()) {
+        invalid("record " + std::to_string(record) + ": vocabulary index out of bounds");
+    }
+    return vocabulary_[index];
+}
+
+std::string_view InventorySnapshot::id(std::size_t i) const {
+    return string(records_[i].id, i);
+}
+
+void InventorySnapshot::read(std::size_t i, Resource& out) const {
+    const snapshot::Record& r = records_[i];
+    out.id.assign(string(r.id, i));
+    out.type           = word(r.type, i);
+    out.classification = word(r.classification, i);
+    if (std::uint64_t { r.tags_begin } + r.tags_size > tag_count_) {
+        invalid("record " + std::to_string(i) + ": tags out of bounds");
+    }
+    out.tags.clear();
+    for (const auto* t = tags_ + r.tags_begin; t != tags_ + r.tags_begin + r.tags_size; ++t) {
+        out.tags.set(word(t->key, i), string(t->value, i));
+    }
+}
+
+Resource InventorySnapshot::read(std::size_t i) const {
+    Resource r;
+    read(i, r);
+    return r;
+}
+
+void InventorySnapshot::validate() const {
+    for (std::size_t i = 0; i < resource_count_; ++i) {
+        const snapshot::Record& r = records_[i];
+        string(r.id, i);
+        word(r.type, i);
+        word(r.classification, i);
+        if (std::uint64_t { r.tags_begin } + r.tags_size > tag_count_) {
+            invalid("record " + std::to_string(i) + ": tags out of bounds");
+        }
+        // The writer sorts each record's tags by key, so a repeated key is
+        // caught as a non-increasing one.
+        for (std::uint32_t t = r.tags_begin; t < r.tags_begin + r.tags_size; ++t) {
+            word(tags_[t].key, i);
+            string(tags_[t].value, i);
+            if (t > r.tags_begin && tags_[t].key <= tags_[t - 1].key) {
+                invalid("record " + std::to_string(i) + ": tag keys not strictly increasing");
+            }
+        }
+    }
+}
+
+// ── SnapshotWriter ───────────────────────────────────────────────────────────
+
+SnapshotWriter::SnapshotWriter() {
+    vocabulary_.push_back({ 0, 0 });
+    vocabulary_index_.emplace(Symbol(), 0);
+}
+
+snapshot::String SnapshotWriter::string(std::string_view text) {
+    if (strings_.size() + text.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("SnapshotWriter: strings exceed 4 GiB");
+    }
+    const snapshot::String s { static_cast<std::uint32_t>(strings_.size()), static_cast<std::uint32_t>(text.size()) };
+    strings_.append(text.data(), text.size());
+    return s;
+}
+
+std::uint32_t SnapshotWriter::word(Symbol symbol) {
+    const auto it = vocabulary_index_.find(symbol);
+    if (it != vocabulary_index_.end()) return it->second;
+    if (vocabulary_.size() == snapshot::kMaxVocabulary) {
+        throw std::length_error("SnapshotWriter: more than " + std::to_string(snapshot::kMaxVocabulary) +
+                                " vocabulary entries");
+    }
+    const auto index = static_cast<std::uint32_t>(vocabulary_.size());
+    vocabulary_.push_back(string(symbol.str()));
+    vocabulary_index_.emplace(symbol, index);
+    return index;
+}
+
+void SnapshotWriter::add(const Resource& resource) {
+    if (tags_.size() + resource.tags.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("SnapshotWriter: more than 2^32 tags");
+    }
+    snapshot::Record record {};
+    record.id             = string(resource.id);
+    record.type           = word(resource.type);
+    record.classification = word(resource.classification);
+    record.tags_begin     = static_cast<std::uint32_t>(tags_.size());
+    record.tags_size      = static_cast<std::uint32_t>(resource.tags.size());
+    for (const auto& [key, value] : resource.tags) tags_.push_back({ word(key), string(value) });
+    std::sort(tags_.begin() + record.tags_begin, tags_.end(),
+              [](const snapshot::Tag& a, const snapshot::Tag& b) { return a.key < b.key; });
+    records_.push_back(record);
+}
+
+void SnapshotWriter::write(std::ostream& out) const {
+    snapshot::Header h {};
+    h.magic             = snapshot::kMagic;
+    h.version           = snapshot::kVersion;
+    h.vocabulary_count  = static_cast<std::uint32_t>(vocabulary_.size());
+    h.resource_count    = records_.size();
+    h.tag_count         = tags_.size();
+    h.vocabulary_offset = align8(sizeof(snapshot::Header));
+    h.records_offset    = align8(h.vocabulary_offset + vocabulary_.size() * sizeof(snapshot::String));
+    h.tags_offset       = align8(h.records_offset + records_.size() * sizeof(snapshot::Record));
+    h.strings_offset    = align8(h.tags_offset + tags_.size() * sizeof(snapshot::Tag));
+    h.strings_size      = strings_.size();
+    h.file_size         = h.strings_offset + h.strings_size;
+
+    std::uint64_t position = 0;
+    const auto emit = [&](const void* data, std::size_t bytes, std::uint64_t at) {
+        static const char padding[8] = {};
+        out.write(padding, static_cast<std::streamsize>(at - position));
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        position = at + bytes;
+    };
+    emit(&h, sizeof h, 0);
+    emit(vocabulary_.data(), vocabulary_.size() * sizeof(snapshot::String), h.vocabulary_offset);
+    emit(records_.data(), records_.size() * sizeof(snapshot::Record), h.records_offset);
+    emit(tags_.data(), tags_.size() * sizeof(snapshot::Tag), h.tags_offset);
+    emit(strings_.data(), strings_.size(), h.strings_offset);
+    out.flush();
+    if (!out) throw std::runtime_error("SnapshotWriter: write failed");
+}
+
+} // namespace governance
@@ -0,0 +1,25 @@
+#include "governance/policy_counters.hpp"
+
+namespace governance {
+
+PolicyCounters::PolicyCounters(std::vector<std::string> policy_names)
+    : names_(std::move(policy_names)),
+      shards_([n = names_.size()] { return std::make_unique<Shard>(n); }) {}
+
+PolicyCounterSnapshot PolicyCounters::snapshot() const {
+    PolicyCounterSnapshot out;
+    out.policies.reserve(names_.size());
+    for (const auto& name : names_) out.policies.push_back({ name });
+
+    shards_.for_each([&](const Shard& shard) {
+        out.evaluations += shard.counts_.load(0);
+        for (std::size_t p = 0; p < names_.size(); ++p) {
+            out.policies[p].allow   += shard.counts_.load(1 + p * 3);
+            out.policies[p].deny    += shard.counts_.load(1 + p * 3 + 1);
+            out.policies[p].abstain += shard.counts_.load(1 + p * 3 + 2);
+        }
+    });
+    return out;
+}
+
+} // namespace governance
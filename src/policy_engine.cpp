@@ -1,143 +1,381 @@
 #include "governance/policy_engine.hpp"
+#include "governance/decision_cache.hpp"
+#include "governance/policy_counters.hpp"
+#include "governance/policy_profiler.hpp"
+#include "governance/static_policy_engine.hpp"
+#include "governance/thread_pool.hpp"
+#include "governance/trace_arena.hpp"
+
+#include <algorithm>
+#include <chrono>
 
 namespace governance {
 
 // ── PolicyEngine ─────────────────────────────────────────────────────────────
 
 void PolicyEngine::register_policy(Policy policy) {
+    key_attributes_ |= policy.reads | policy.applies_to.reads();
+    cacheable_ = cacheable_ && policy.reads.cacheable();
     policies_.push_back(std::move(policy));
+    rebuild_index();
+    if (cache_) cache_ = cache_->invalidated();
+    if (counters_) enable_counters();
+    if (profiler_) enable_profiling(profiler_->step_durations());
 }
 
-EvaluationResult PolicyEngine::evaluate(const RequestContext& ctx) const {
-    EvaluationTrace trace;
-    trace.context = ctx;
-    std::optional<PolicyDecision> first_allow;
+void PolicyEngine::rebuild_index() {
+    std::vector<Symbol> named_roles;
+    for (const auto& policy : policies_)
+        for (auto role : policy.applies_to.roles)
+            if (std::find(named_roles.begin(), named_roles.end(), role) == named_roles.end())
+                named_roles.push_back(role);
 
-    for (const auto& policy : policies_) {
-        auto decision = policy.evaluate(ctx);
-        if (!decision) {
-            trace.steps.push_back({ policy.name, StepOutcome::Abstain, "" });
-            continue;
-        }
+    candidate_lists_.assign(1, {});
+    list_of_role_.clear();
+    for (std::uint32_t i = 0; i < policies_.size(); ++i)
+        if (policies_[i].applies_to.roles.empty()) candidate_lists_[0].push_back(i);
 
-        if (decision->effect == Effect::Deny) {
-            trace.steps.push_back({ policy.name, StepOutcome::Deny, decision->reason });
-            return { *decision, std::move(trace) };
+    for (auto role : named_roles) {
+        std::vector<std::uint32_t> list;
+        for (std::uint32_t i = 0; i < policies_.size(); ++i) {
+            const auto& roles = policies_[i].applies_to.roles;
+            if (roles.empty() || std::find(roles.begin(), roles.end(), role) != roles.end())
+                list.push_back(i);
         }
+        if (role.id() >= list_of_role_.size()) list_of_role_.resize(role.id() + 1, 0);
+        list_of_role_[role.id()] = static_cast<std::uint32_t>(candidate_lists_.size());
+        candidate_lists_.push_back(std::move(list));
+    }
+}
 
-        trace.steps.push_back({ policy.name, StepOutcome::Allow, decision->reason });
-        if (!first_allow) {
-            first_allow = decision;
-        }
+EvaluationResult PolicyEngine::evaluate(const RequestContext& ctx) const {
+    if (!cache_active()) return evaluate_uncached(ctx);
+
+    const auto key = DecisionKey::from(ctx, key_attributes_);
+    CachedDecision hit;
+    if (cache_->lookup(key, hit)) {
+        return { std::move(hit.decision), EvaluationTrace{ ctx, std::move(hit.steps) } };
     }
+    auto result = evaluate_uncached(ctx);
+    cache_->insert(key, { result.decision, result.trace.steps });
+    return result;
+}
 
-    if (first_allow) return { *first_allow, std::move(trace) };
+Effect PolicyEngine::decide(const RequestContext& ctx) const {
+    if (!cache_active()) return decide_uncached(ctx);
 
-    PolicyDecision default_deny { Effect::Deny, "default", "No policy explicitly granted access." };
-    return { default_deny, std::move(trace) };
+    // A miss runs the traced path once so later evaluate() calls can hit too.
+    const auto key = DecisionKey::from(ctx, key_attributes_);
+    if (auto effect = cache_->lookup_effect(key)) return *effect;
+    auto result = evaluate_uncached(ctx);
+    cache_->insert(key, { result.decision, std::move(result.trace.steps) });
+    return result.decision.effect;
 }
 
-// ── Built-in policies ─────────────────────────────────────────────────────────
+namespace {
 
-Policy admin_full_access() {
-    return {
-        "AdminFullAccess",
-        "1.0",
-        "governance-team",
-        "Grants unrestricted access to all principals with the admin role.",
-        [](const RequestContext& ctx) -> std::optional<PolicyDecision> {
-            if (ctx.principal.role == "admin") {
-                return PolicyDecision{ Effect::Allow, "AdminFullAccess",
-                    "Admin role has unrestricted access." };
-            }
-            return std::nullopt;
-        }
-    };
+constexpr std::string_view kDefaultPolicy = "default";
+constexpr std::string_view kDefaultReason = "No policy explicitly granted access.";
+
+// Calls a policy, preferring its allocation-free form. When only `evaluate`
+// is set, `owned` keeps the decision alive for the returned view.
+std::optional<DecisionView> call_policy(const Policy& policy, const RequestContext& ctx,
+                                        std::optional<PolicyDecision>& owned) {
+    if (policy.evaluate_view) return policy.evaluate_view(ctx);
+    owned = policy.evaluate(ctx);
+    if (!owned) return std::nullopt;
+    return view_of(*owned);
 }
 
-Policy mfa_required_for_restricted() {
-    return {
-        "MFARequiredForRestricted",
-        "1.0",
-        "governance-team",
-        "Denies access to restricted resources when MFA has not been verified.",
-        [](const RequestContext& ctx) -> std::optional<PolicyDecision> {
-            if (ctx.resource.classification == "restricted" && !ctx.mfa_verified) {
-                return PolicyDecision{ Effect::Deny, "MFARequiredForRestricted",
-                    "MFA required to access restricted resources." };
-            }
-            return std::nullopt;
+// This thread's shards of the engine's optional counters and profiler.
+struct Instruments {
+    PolicyCounters::Shard* counts         = nullptr;
+    PolicyProfiler::Shard* timing         = nullptr;
+    bool                   step_durations = false;
+
+    Instruments(PolicyCounters* counters, PolicyProfiler* profiler) {
+        if (counters) {
+            counts = &counters->local();
+            counts->record_evaluation();
         }
-    };
+        if (profiler) {
+            timing         = &profiler->local();
+            step_durations = profiler->step_durations();
+        }
+    }
+    explicit operator bool() const { return counts || timing; }
+};
+
+// call_policy() with counting and timing. `duration_ns` receives the time
+// spent in the policy when it is timed.
+std::optional<DecisionView> call_policy(const Policy& policy, std::size_t index,
+                                        const RequestContext& ctx,
+                                        std::optional<PolicyDecision>& owned,
+                                        const Instruments& instruments,
+                                        std::uint64_t& duration_ns) {
+    if (!instruments) return call_policy(policy, ctx, owned);
+
+    using Clock = std::chrono::steady_clock;
+    const auto start    = instruments.timing ? Clock::now() : Clock::time_point{};
+    auto       decision = call_policy(policy, ctx, owned);
+    if (instruments.timing) {
+        duration_ns = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        instruments.timing->record(index, duration_ns);
+    }
+    if (instruments.counts) instruments.counts->record(index, decision ? &*decision : nullptr);
+    return decision;
 }
 
-Policy production_immutability() {
-    return {
-        "ProductionImmutability",
-        "1.0",
-        "governance-team",
-        "Prevents non-admin principals from writing or deleting in production.",
-        [](const RequestContext& ctx) -> std::optional<PolicyDecision> {
-            if (ctx.environment == "production" &&
-                ctx.principal.role != "admin" &&
-                (ctx.action.verb == "write" || ctx.action.verb == "delete")) {
-                return PolicyDecision{ Effect::Deny, "ProductionImmutability",
-                    "Write/delete operations require admin role in production." };
-            }
-            return std::nullopt;
+} // namespace
+
+template <typename OnStep>
+void PolicyEngine::trace_policies(const RequestContext& ctx, OnStep&& on_step) const {
+    // Policies the index rules out still appear in the trace as Abstain, so
+    // the trace is the same as if every policy had been called.
+    const Instruments instruments(counters_.get(), profiler_.get());
+    std::size_t next = 0;
+    for (auto index : candidates(ctx)) {
+        for (; next < index; ++next) on_step(next, nullptr, true, 0);
+
+        const auto& policy = policies_[next];
+        std::optional<PolicyDecision> owned;
+        std::optional<DecisionView>   decision;
+        std::uint64_t                 duration_ns = 0;
+        if (policy.applies_to.matches(ctx)) {
+            decision = call_policy(policy, next, ctx, owned, instruments, duration_ns);
         }
-    };
+        if (!instruments.step_durations) duration_ns = 0;
+        if (!on_step(next++, decision ? &*decision : nullptr, !owned, duration_ns)) return;
+    }
+    for (; next < policies_.size(); ++next) on_step(next, nullptr, true, 0);
 }
 
-Policy analyst_read_only() {
-    return {
-        "AnalystReadOnly",
-        "1.0",
-        "governance-team",
-        "Restricts analysts to read-only access on non-sensitive resources.",
-        [](const RequestContext& ctx) -> std::optional<PolicyDecision> {
-            if (ctx.principal.role != "analyst") return std::nullopt;
-
-            if (ctx.action.verb != "read") {
-                return PolicyDecision{ Effect::Deny, "AnalystReadOnly",
-                    "Analysts are limited to read-only access." };
-            }
-            if (ctx.resource.classification == "restricted" ||
-                ctx.resource.classification == "confidential") {
-                return PolicyDecision{ Effect::Deny, "AnalystReadOnly",
-                    "Analysts cannot access confidential or restricted data." };
-            }
-            return PolicyDecision{ Effect::Allow, "AnalystReadOnly",
-                "Analyst read access on non-sensitive resource allowed." };
+EvaluationResult PolicyEngine::evaluate_uncached(const RequestContext& ctx) const {
+    EvaluationResult result { { Effect::Deny, std::string(kDefaultPolicy), std::string(kDefaultReason) },
+                              { ctx, {} } };
+    auto& steps = result.trace.steps;
+    steps.reserve(policies_.size());
+    std::optional<PolicyDecision> first_allow;
+    bool denied = false;
+
+    trace_policies(ctx, [&](std::size_t i, const DecisionView* decision, bool, std::uint64_t ns) {
+        const auto& name = policies_[i].name;
+        if (!decision) {
+            steps.push_back({ name, StepOutcome::Abstain, "", ns });
+            return true;
+        }
+        if (decision->effect == Effect::Deny) {
+            steps.push_back({ name, StepOutcome::Deny, std::string(decision->reason), ns });
+            result.decision = decision->to_decision();
+            denied = true;
+            return false;
         }
+        steps.push_back({ name, StepOutcome::Allow, std::string(decision->reason), ns });
+        if (!first_allow) first_allow = decision->to_decision();
+        return true;
+    });
+
+    if (!denied && first_allow) result.decision = std::move(*first_allow);
+    return result;
+}
+
+EvaluationView PolicyEngine::evaluate(const RequestContext& ctx, TraceArena& arena) const {
+    if (!cache_active()) return evaluate_uncached(ctx, arena);
+
+    // Cached steps line up with policies_ (the cache is invalidated whenever
+    // a policy is registered), so names can point at the policies; the rest
+    // is copied into the arena while the entry is locked.
+    auto view_of = [&](const PolicyDecision& decision, const std::vector<PolicyStep>& steps) {
+        auto* out = arena.allocate_array<StepView>(steps.size());
+        for (std::size_t i = 0; i < steps.size(); ++i)
+            out[i] = { policies_[i].name, steps[i].outcome, arena.store(steps[i].reason),
+                       steps[i].duration_ns };
+        return EvaluationView {
+            { decision.effect, arena.store(decision.policy_name), arena.store(decision.reason) },
+            { &ctx, out, steps.size() },
+        };
     };
+
+    const auto key = DecisionKey::from(ctx, key_attributes_);
+    EvaluationView view {};
+    if (cache_->visit(key, [&](const CachedDecision& hit) { view = view_of(hit.decision, hit.steps); })) {
+        return view;
+    }
+    auto result = evaluate_uncached(ctx);
+    view = view_of(result.decision, result.trace.steps);
+    cache_->insert(key, { std::move(result.decision), std::move(result.trace.steps) });
+    return view;
 }
 
-Policy engineer_access() {
-    return {
-        "EngineerAccess",
-        "1.0",
-        "governance-team",
-        "Grants engineers full access in dev/staging and read-only in production.",
-        [](const RequestContext& ctx) -> std::optional<PolicyDecision> {
-            if (ctx.principal.role != "engineer") return std::nullopt;
-
-            // Defer restricted resources to other policies (e.g. MFA check)
-            if (ctx.resource.classification == "restricted") return std::nullopt;
-
-            if (ctx.environment == "dev" || ctx.environment == "staging") {
-                return PolicyDecision{ Effect::Allow, "EngineerAccess",
-                    "Engineers have full access in non-production environments." };
-            }
-            if (ctx.environment == "production" && ctx.action.verb == "read") {
-                return PolicyDecision{ Effect::Allow, "EngineerAccess",
-                    "Engineers can read production resources." };
-            }
-            return std::nullopt;
+EvaluationView PolicyEngine::evaluate_uncached(const RequestContext& ctx, TraceArena& arena) const {
+    auto* steps = arena.allocate_array<StepView>(policies_.size());
+    EvaluationView view { { Effect::Deny, kDefaultPolicy, kDefaultReason }, { &ctx, steps, 0 } };
+    std::optional<DecisionView> first_allow;
+    bool denied = false;
+
+    trace_policies(ctx, [&](std::size_t i, const DecisionView* decision, bool borrowed,
+                            std::uint64_t ns) {
+        const std::string_view name = policies_[i].name;
+        StepView& step = steps[view.trace.step_count++];
+        step = { name, StepOutcome::Abstain, {}, ns };
+        if (!decision) return true;
+
+        // Borrowed views already point at static storage. Otherwise copy into
+        // the arena, except a reported name equal to the policy's own.
+        DecisionView decided = *decision;
+        if (!borrowed) {
+            decided.policy_name = decided.policy_name == name ? name : arena.store(decided.policy_name);
+            decided.reason      = arena.store(decided.reason);
         }
-    };
+        step.reason = decided.reason;
+        if (decided.effect == Effect::Deny) {
+            step.outcome  = StepOutcome::Deny;
+            view.decision = decided;
+            denied        = true;
+            return false;
+        }
+        step.outcome = StepOutcome::Allow;
+        if (!first_allow) first_allow = decided;
+        return true;
+    });
+
+    if (!denied && first_allow) view.decision = *first_allow;
+    return view;
+}
+
+Effect PolicyEngine::decide_uncached(const RequestContext& ctx) const {
+    const Instruments instruments(counters_.get(), profiler_.get());
+    bool allowed = false;
+
+    for (auto index : candidates(ctx)) {
+        const auto& policy = policies_[index];
+        if (!policy.applies_to.matches(ctx)) continue;
+        std::optional<PolicyDecision> owned;
+        std::uint64_t                 duration_ns = 0;
+        auto decision = call_policy(policy, index, ctx, owned, instruments, duration_ns);
+        if (!decision) continue;
+        if (decision->effect == Effect::Deny) return Effect::Deny;
+        allowed = true;
+    }
+    return allowed ? Effect::Allow : Effect::Deny;
+}
+
+// ── Batch evaluation ─────────────────────────────────────────────────────────
+
+template <typename Fn>
+void PolicyEngine::for_each_chunk(std::size_t count, Fn&& fn) const {
+    if (!pool_ || pool_->concurrency() == 1) {
+        fn(0, count);
+        return;
+    }
+    // Several chunks per thread so a slow chunk does not stall the batch,
+    // but large enough to amortise claiming work from the shared cursor.
+    const std::size_t chunk = std::max<std::size_t>(64, count / (pool_->concurrency() * 8));
+    pool_->parallel_for(count, chunk, fn);
+}
+
+void PolicyEngine::evaluate_batch(const RequestContext* requests, std::size_t count,
+                                  EvaluationResult* results) const {
+    for_each_chunk(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) results[i] = evaluate(requests[i]);
+    });
+}
+
+std::vector<EvaluationResult>
+PolicyEngine::evaluate_batch(const std::vector<RequestContext>& requests) const {
+    std::vector<EvaluationResult> results(requests.size());
+    evaluate_batch(requests.data(), requests.size(), results.data());
+    return results;
+}
+
+void PolicyEngine::decide_batch(const RequestContext* requests, std::size_t count,
+                                Effect* effects) const {
+    for_each_chunk(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) effects[i] = decide(requests[i]);
+    });
+}
+
+std::vector<Effect> PolicyEngine::decide_batch(const std::vector<RequestContext>& requests) const {
+    std::vector<Effect> effects(requests.size(), Effect::Deny);
+    decide_batch(requests.data(), requests.size(), effects.data());
+    return effects;
+}
+
+void PolicyEngine::set_concurrency(std::size_t threads) {
+    if (threads == 1) {
+        pool_.reset();
+        return;
+    }
+    pool_ = std::make_shared<ThreadPool>(threads);
+}
+
+std::size_t PolicyEngine::concurrency() const {
+    return pool_ ? pool_->concurrency() : 1;
+}
+
+// ── Decision cache ───────────────────────────────────────────────────────────
+
+void PolicyEngine::enable_cache(std::size_t capacity, std::size_t shards) {
+    if (capacity == 0) {
+        disable_cache();
+        return;
+    }
+    cache_ = std::make_shared<DecisionCache>(capacity, shards);
 }
 
+void PolicyEngine::disable_cache() {
+    cache_.reset();
+}
+
+CacheStats PolicyEngine::cache_stats() const {
+    return cache_ ? cache_->stats() : CacheStats{};
+}
+
+// ── Policy counters ──────────────────────────────────────────────────────────
+
+void PolicyEngine::enable_counters() {
+    std::vector<std::string> names;
+    names.reserve(policies_.size());
+    for (const auto& policy : policies_) names.push_back(policy.name);
+    counters_ = std::make_shared<PolicyCounters>(std::move(names));
+}
+
+void PolicyEngine::disable_counters() {
+    counters_.reset();
+}
+
+PolicyCounterSnapshot PolicyEngine::counter_snapshot() const {
+    return counters_ ? counters_->snapshot() : PolicyCounterSnapshot{};
+}
+
+// ── Profiling ────────────────────────────────────────────────────────────────
+
+void PolicyEngine::enable_profiling(bool step_durations) {
+    std::vector<std::string> names;
+    names.reserve(policies_.size());
+    for (const auto& policy : policies_) names.push_back(policy.name);
+    profiler_ = std::make_shared<PolicyProfiler>(std::move(names), step_durations);
+}
+
+void PolicyEngine::disable_profiling() {
+    profiler_.reset();
+}
+
+PolicyProfile PolicyEngine::profile_snapshot() const {
+    return profiler_ ? profiler_->snapshot() : PolicyProfile{};
+}
+
+// ── Built-in policies ─────────────────────────────────────────────────────────
+
+// Bodies live in builtin_policies.hpp so StaticPolicyEngine can inline them.
+
+Policy admin_full_access()           { return make_policy<builtin::AdminFullAccess>(); }
+Policy mfa_required_for_restricted() { return make_policy<builtin::MFARequiredForRestricted>(); }
+Policy production_immutability()     { return make_policy<builtin::ProductionImmutability>(); }
+Policy analyst_read_only()           { return make_policy<builtin::AnalystReadOnly>(); }
+Policy engineer_access()             { return make_policy<builtin::EngineerAccess>(); }
+
 PolicyEngine default_policy_engine() {
     PolicyEngine engine;
     engine.register_policy(admin_full_access());
@@ -0,0 +1,29 @@
+#include "governance/policy_profiler.hpp"
+
+namespace governance {
+
+PolicyProfiler::PolicyProfiler(std::vector<std::string> policy_names, bool step_durations)
+    : names_(std::move(policy_names)),
+      step_durations_(step_durations),
+      shards_([n = names_.size()] { return std::make_unique<Shard>(n); }) {}
+
+PolicyProfile PolicyProfiler::snapshot() const {
+    PolicyProfile out;
+    out.policies.reserve(names_.size());
+    for (const auto& name : names_) out.policies.push_back({ name, {} });
+
+    shards_.for_each([&](const Shard& shard) {
+        for (std::size_t p = 0; p < names_.size(); ++p) {
+            const std::size_t base = p * Shard::kStride;
+            auto& latency = out.policies[p].latency;
+            for (std::size_t b = 0; b < LatencyHistogram::kBuckets; ++b) {
+                if (const auto n = shard.counts_.load(base + b)) latency.add_bucket(b, n);
+            }
+            latency.add_totals(shard.counts_.load(base + Shard::kSum),
+                               shard.counts_.load(base + Shard::kMax));
+        }
+    });
+    return out;
+}
+
+} // namespace governance
@@ -0,0 +1,321 @@
+#include "governance/resource_reader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace governance {
+
+namespace {
+
+// ── Parser ───────────────────────────────────────────────────────────────────
+
+// A recursive-descent reader over one line. It decodes only what a Resource
+// needs and skips everything else without copying it.
+class Parser {
+public:
+    static constexpr int kMaxDepth = 64;
+
+    explicit Parser(std::string_view text) : p_(text.data()), end_(text.data() + text.size()) {}
+
+    void ws() {
+        while (p_ < end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\r' || *p_ == '\n')) ++p_;
+    }
+    bool consume(char c) {
+        ws();
+        if (p_ == end_ || *p_ != c) return false;
+        ++p_;
+        return true;
+    }
+    void expect(char c) {
+        if (!consume(c)) fail(std::string("expected '") + c + "'");
+    }
+    bool done() {
+        ws();
+        return p_ == end_;
+    }
+    bool null() {
+        ws();
+        return literal("null");
+    }
+
+    /// A string, decoded into `out`, or null, read as the empty string.
+    void string(std::string& out) {
+        ws();
+        out.clear();
+        if (literal("null")) return;
+        if (p_ == end_ || *p_ != '"') fail("expected a string");
+        ++p_;
+        for (;;) {
+            const char* run = p_;
+            while (p_ < end_ && *p_ != '"' && *p_ != '\\' && static_cast<unsigned char>(*p_) >= 0x20) ++p_;
+            out.append(run, p_);
+            if (p_ == end_) fail("unterminated string");
+            const char c = *p_++;
+            if (c == '"') return;
+            if (c != '\\') fail("control character in string");
+            escape(out);
+        }
+    }
+
+    void skip_value(int depth = 0) {
+        if (depth > kMaxDepth) fail("nesting too deep");
+        ws();
+        if (p_ == end_) fail("expected a value");
+        switch (*p_) {
+            case '"':
+                skip_string();
+                return;
+            case '{':
+                ++p_;
+                if (consume('}')) return;
+                do {
+                    ws();
+                    if (p_ == end_ || *p_ != '"') fail("expected a member name");
+                    skip_string();
+                    expect(':');
+                    skip_value(depth + 1);
+                } while (consume(','));
+                expect('}');
+                return;
+            case '[':
+                ++p_;
+                if (consume(']')) return;
+                do {
+                    skip_value(depth + 1);
+                } while (consume(','));
+                expect(']');
+                return;
+            default:
+                if (literal("true") || literal("false") || literal("null")) return;
+                skip_number();
+        }
+    }
+
+private:
+    [[noreturn]] static void fail(const std::string& message) {
+        throw std::runtime_error(message);
+    }
+
+    bool literal(std::string_view word) {
+        if (static_cast<std::size_t>(end_ - p_) < word.size() || std::string_view(p_, word.size()) != word)
+            return false;
+        p_ += word.size();
+        return true;
+    }
+
+    void skip_string() {
+        ++p_;   // opening quote
+        while (p_ < end_ && *p_ != '"') p_ += *p_ == '\\' ? 2 : 1;
+        if (p_ >= end_) fail("unterminated string");
+        ++p_;
+    }
+
+    void skip_number() {
+        const char* start = p_;
+        while (p_ < end_ && ((*p_ >= '0' && *p_ <= '9') || *p_ == '-' || *p_ == '+' ||
+                             *p_ == '.' || *p_ == 'e' || *p_ == 'E')) {
+            ++p_;
+        }
+        if (p_ == start) fail("expected a value");
+    }
+
+    unsigned hex4() {
+        if (end_ - p_ < 4) fail("truncated \\u escape");
+        unsigned v = 0;
+        for (int i = 0; i < 4; ++i) {
+            const char c = *p_++;
+            v <<= 4;
+            if (c >= '0' && c <= '9')      v |= static_cast<unsigned>(c - '0');
+            else if (c >= 'a' && c <= 'f') v |= static_cast<unsigned>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') v |= static_cast<unsigned>(c - 'A' + 10);
+            else fail("invalid \\u escape");
+        }
+        return v;
+    }
+
+    void escape(std::string& out) {
+        if (p_ == end_) fail("unterminated string");
+        switch (*p_++) {
+            case '"':  out += '"';  return;
+            case '\\': out += '\\'; return;
+            case '/':  out += '/';  return;
+            case 'b':  out += '\b'; return;
+            case 'f':  out += '\f'; return;
+            case 'n':  out += '\n'; return;
+            case 'r':  out += '\r'; return;
+            case 't':  out += '\t'; return;
+            case 'u':  break;
+            default:   fail("invalid escape");
+        }
+        unsigned cp = hex4();
+        if (cp >= 0xDC00 && cp <= 0xDFFF) fail("unpaired surrogate");
+        if (cp >= 0xD800 && cp <= 0xDBFF) {
+            if (!literal("\\u")) fail("unpaired surrogate");
+            const unsigned low = hex4();
+            if (low < 0xDC00 || low > 0xDFFF) fail("unpaired surrogate");
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+        }
+        // UTF-8
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | cp >> 6);
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | cp >> 12);
+            out += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | cp >> 18);
+            out += static_cast<char>(0x80 | (cp >> 12 & 0x3F));
+            out += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    const char* p_;
+    const char* end_;
+};
+
+bool blank(std::string_view line) {
+    return std::all_of(line.begin(), line.end(),
+                       [](char c) { return c == ' ' || c == '\t' || c == '\r'; });
+}
+
+} // namespace
+
+// ── ResourceReader ───────────────────────────────────────────────────────────
+
+ResourceReader::ResourceReader(std::istream& in, std::size_t max_symbols)
+    : in_(in), buffer_(kBufferSize), max_symbols_(max_symbols) {}
+
+bool ResourceReader::next(Resource& out) {
+    std::string_view line;
+    while (next_line(line)) {
+        if (blank(line)) continue;
+        try {
+            parse(line, out);
+        } catch (const std::runtime_error& e) {
+            throw std::runtime_error("line " + std::to_string(line_) + ": " + e.what());
+        } catch (const std::length_error& e) {   // the process-wide symbol table is full
+            throw std::runtime_error("line " + std::to_string(line_) + ": " + e.what());
+        }
+        return true;
+    }
+    return false;
+}
+
+bool ResourceReader::next_line(std::string_view& line) {
+    bool too_long = false;
+    std::size_t scanned = begin_;   // buffer_[begin_, scanned) holds no newline
+    for (;;) {
+        const char* data = buffer_.data();
+        if (const void* nl = std::memchr(data + scanned, '\n', end_ - scanned)) {
+            const auto pos = static_cast<std::size_t>(static_cast<const char*>(nl) - data);
+            line   = { data + begin_, pos - begin_ };
+            begin_ = pos + 1;
+            ++line_;
+            break;
+        }
+        if (eof_) {
+            if (begin_ == end_ && !too_long) return false;
+            line   = { data + begin_, end_ - begin_ };   // last line, unterminated
+            begin_ = end_;
+            ++line_;
+            break;
+        }
+
+        // Make room for more input: compact, then grow, and past kMaxLine
+        // drop the line's prefix and keep reading until its end.
+        if (begin_ > 0) {
+            std::memmove(buffer_.data(), data + begin_, end_ - begin_);
+            end_  -= begin_;
+            begin_ = 0;
+        }
+        if (end_ == buffer_.size()) {
+            if (buffer_.size() < kMaxLine) {
+                buffer_.resize(std::min(buffer_.size() * 2, kMaxLine));
+            } else {
+                too_long = true;
+                end_     = 0;
+            }
+        }
+        scanned = end_;
+        in_.read(buffer_.data() + end_, static_cast<std::streamsize>(buffer_.size() - end_));
+        end_ += static_cast<std::size_t>(in_.gcount());
+        if (!in_) eof_ = true;
+        if (in_.bad()) throw std::runtime_error("line " + std::to_string(line_ + 1) + ": read error");
+    }
+    if (too_long) throw std::runtime_error("line " + std::to_string(line_) + ": longer than kMaxLine");
+    return true;
+}
+
+void ResourceReader::parse(std::string_view line, Resource& out) {
+    Parser in(line);
+    out.id.clear();
+    out.type           = Symbol();
+    out.classification = Symbol();
+    std::size_t tags = 0;
+
+    in.expect('{');
+    if (!in.consume('}')) {
+        do {
+            in.string(key_);
+            in.expect(':');
+            if (key_ == "id") {
+                in.string(out.id);
+            } else if (key_ == "type") {
+                in.string(value_);
+                out.type = intern(value_);
+            } else if (key_ == "classification") {
+                in.string(value_);
+                out.classification = intern(value_);
+            } else if (key_ == "tags") {
+                if (!in.null()) {
+                    in.expect('{');
+                    if (!in.consume('}')) {
+                        do {
+                            if (tags == tags_.size()) tags_.emplace_back();
+                            in.string(tags_[tags].first);
+                            in.expect(':');
+                            in.string(tags_[tags].second);
+                            ++tags;
+                        } while (in.consume(','));
+                        in.expect('}');
+                    }
+                }
+            } else {
+                in.skip_value();
+            }
+        } while (in.consume(','));
+        in.expect('}');
+    }
+    if (!in.done()) throw std::runtime_error("trailing characters after the record");
+
+    // clear() keeps the TagSet's storage, so similar records refill it in place.
+    out.tags.clear();
+    for (std::size_t i = 0; i < tags; ++i) out.tags.set(intern_key(tags_[i].first), tags_[i].second);
+}
+
+Symbol ResourceReader::intern(const std::string& text) {
+    if (const auto known = Symbol::lookup(text)) return *known;
+    if (symbols_ == max_symbols_) {
+        throw std::runtime_error("more than " + std::to_string(max_symbols_) +
+                                 " distinct type, classification and tag-key values");
+    }
+    ++symbols_;
+    return Symbol(text);
+}
+
+Symbol ResourceReader::intern_key(const std::string& key) {
+    for (const auto& [text, symbol] : keys_) {
+        if (text == key) return symbol;
+    }
+    const Symbol symbol = intern(key);
+    if (keys_.size() < kKeyCache) keys_.emplace_back(key, symbol);
+    return symbol;
+}
+
+} // namespace governance
@@ -0,0 +1,420 @@
+#include "governance/shm_transport.hpp"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+namespace governance {
+
+namespace {
+
+[[noreturn]] void throw_errno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+constexpr std::uint64_t kMagic            = 0x4d48535f564f47ull;   // "GOV_SHM"
+constexpr std::uint32_t kVersion          = 1;
+constexpr std::uint32_t kResponseSlotSize = 16;
+constexpr std::uint32_t kMaxSlots         = 1u << 20;
+constexpr std::size_t   kServerBatch      = 64;
+
+static_assert(wire::kResponseSize <= kResponseSlotSize, "response frame must fit its slot");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "ring positions are shared between processes");
+
+std::size_t round_up(std::size_t n, std::size_t to) { return (n + to - 1) / to * to; }
+
+} // namespace
+
+// ── Backoff ──────────────────────────────────────────────────────────────────
+
+void Backoff::pause() {
+    if (step_ < kSpinSteps) {
+        cpu_relax();
+    } else if (step_ < kSpinSteps + kYieldSteps) {
+        std::this_thread::yield();
+    } else {
+        const std::uint32_t doublings = std::min<std::uint32_t>(step_ - kSpinSteps - kYieldSteps, 8);
+        const std::uint32_t micros    = std::min<std::uint32_t>(1u << doublings, kMaxSleepMicros);
+        std::this_thread::sleep_for(std::chrono::microseconds(micros));
+    }
+    if (step_ < UINT32_MAX) ++step_;
+}
+
+// ── SpscRing ─────────────────────────────────────────────────────────────────
+
+SpscRing::SpscRing(Side side, RingPositions* positions, std::uint8_t* slots,
+                   std::uint32_t slot_count, std::uint32_t slot_size)
+    : positions_(positions), slots_(slots), mask_(slot_count - 1),
+      slot_size_(slot_size), count_(slot_count) {
+    if (side == Side::Producer) {
+        local_ = positions_->head.load(std::memory_order_relaxed);
+        limit_ = positions_->tail.load(std::memory_order_acquire) + count_;
+    } else {
+        local_ = positions_->tail.load(std::memory_order_relaxed);
+        limit_ = positions_->head.load(std::memory_order_acquire);
+    }
+}
+
+std::uint8_t* SpscRing::try_claim() {
+    if (local_ == limit_) {
+        limit_ = positions_->tail.load(std::memory_order_acquire) + count_;
+        if (local_ == limit_) return nullptr;
+    }
+    return slot(local_++);
+}
+
+void SpscRing::publish() {
+    positions_->head.store(local_, std::memory_order_release);
+}
+
+const std::uint8_t* SpscRing::try_read() {
+    if (local_ == limit_) {
+        limit_ = positions_->head.load(std::memory_order_acquire);
+        if (local_ == limit_) return nullptr;
+    }
+    return slot(local_++);
+}
+
+void SpscRing::release() {
+    positions_->tail.store(local_, std::memory_order_release);
+}
+
+// ── ShmChannel ───────────────────────────────────────────────────────────────
+
+struct ShmChannel::Header {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t slots;
+    std::uint32_t request_slot_size;
+    std::uint32_t response_slot_size;
+    std::uint64_t request_offset;
+    std::uint64_t response_offset;
+    std::uint64_t total_size;
+
+    alignas(64) std::atomic<std::uint32_t> detached { 0 };
+    RingPositions requests;
+    RingPositions responses;
+};
+
+ShmChannel ShmChannel::create(std::uint32_t slots, std::uint32_t request_slot_size) {
+    std::uint32_t count = 1;
+    while (count < slots && count < kMaxSlots) count <<= 1;
+    if (request_slot_size < wire::kHeaderSize + 8) {
+        throw std::invalid_argument("ShmChannel: request slots too small for any request");
+    }
+
+    const std::size_t request_offset  = round_up(sizeof(Header), 64);
+    const std::size_t response_offset = round_up(request_offset + std::size_t(count) * request_slot_size, 64);
+    const std::size_t total           = response_offset + std::size_t(count) * kResponseSlotSize;
+
+    ShmChannel channel;
+    channel.fd_ = ::memfd_create("governance-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (channel.fd_ < 0) throw_errno("memfd_create");
+    if (::ftruncate(channel.fd_, static_cast<off_t>(total)) < 0) throw_errno("ftruncate");
+    // The server maps what the client sends; a fixed size rules out SIGBUS.
+    if (::fcntl(channel.fd_, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) < 0) {
+        throw_errno("fcntl(F_ADD_SEALS)");
+    }
+    channel.base_ = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, channel.fd_, 0);
+    if (channel.base_ == MAP_FAILED) {
+        channel.base_ = nullptr;
+        throw_errno("mmap");
+    }
+    channel.size_ = total;
+
+    auto* h = new (channel.base_) Header{};
+    h->magic              = kMagic;
+    h->version            = kVersion;
+    h->slots              = count;
+    h->request_slot_size  = request_slot_size;
+    h->response_slot_size = kResponseSlotSize;
+    h->request_offset     = request_offset;
+    h->response_offset    = response_offset;
+    h->total_size         = total;
+
+    channel.slots_             = count;
+    channel.request_slot_size_ = request_slot_size;
+    channel.request_offset_    = request_offset;
+    channel.response_offset_   = response_offset;
+    return channel;
+}
+
+ShmChannel ShmChannel::attach(int fd) {
+    ShmChannel channel;
+    channel.fd_ = fd;
+
+    const int seals = ::fcntl(fd, F_GET_SEALS);
+    if (seals < 0) throw_errno("fcntl(F_GET_SEALS)");
+    if (!(seals & F_SEAL_SHRINK)) throw std::invalid_argument("ShmChannel: memfd is not sealed");
+
+    struct stat st {};
+    if (::fstat(fd, &st) < 0) throw_errno("fstat");
+    const auto size = static_cast<std::size_t>(st.st_size);
+    if (size < sizeof(Header)) throw std::invalid_argument("ShmChannel: too small");
+
+    channel.base_ = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (channel.base_ == MAP_FAILED) {
+        channel.base_ = nullptr;
+        throw_errno("mmap");
+    }
+    channel.size_ = size;
+
+    // Read each field once into a local and check the copies; the client can
+    // rewrite the header at any time.
+    const Header* h = channel.header();
+    const std::uint64_t magic              = h->magic;
+    const std::uint32_t version            = h->version;
+    const std::uint64_t total_size         = h->total_size;
+    const std::uint32_t slots              = h->slots;
+    const std::uint32_t request_slot_size  = h->request_slot_size;
+    const std::uint32_t response_slot_size = h->response_slot_size;
+    const std::uint64_t request_offset     = h->request_offset;
+    const std::uint64_t response_offset    = h->response_offset;
+    const bool valid =
+        magic == kMagic && version == kVersion && total_size == size &&
+        slots != 0 && slots <= kMaxSlots && (slots & (slots - 1)) == 0 &&
+        request_slot_size >= wire::kHeaderSize + 8 && response_slot_size == kResponseSlotSize &&
+        request_offset >= sizeof(Header) && request_offset <= size &&
+        request_offset + std::uint64_t(slots) * request_slot_size <= response_offset &&
+        response_offset <= size &&
+        response_offset + std::uint64_t(slots) * kResponseSlotSize <= size;
+    if (!valid) throw std::invalid_argument("ShmChannel: invalid channel header");
+
+    channel.slots_             = slots;
+    channel.request_slot_size_ = request_slot_size;
+    channel.request_offset_    = static_cast<std::size_t>(request_offset);
+    channel.response_offset_   = static_cast<std::size_t>(response_offset);
+    return channel;
+}
+
+ShmChannel::ShmChannel(ShmChannel&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)),
+      base_(std::exchange(other.base_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      slots_(std::exchange(other.slots_, 0)),
+      request_slot_size_(std::exchange(other.request_slot_size_, 0)),
+      request_offset_(std::exchange(other.request_offset_, 0)),
+      response_offset_(std::exchange(other.response_offset_, 0)) {}
+
+ShmChannel& ShmChannel::operator=(ShmChannel&& other) noexcept {
+    if (this != &other) {
+        this->~ShmChannel();
+        new (this) ShmChannel(std::move(other));
+    }
+    return *this;
+}
+
+ShmChannel::~ShmChannel() {
+    if (base_) ::munmap(base_, size_);
+    if (fd_ >= 0) ::close(fd_);
+}
+
+SpscRing ShmChannel::requests(SpscRing::Side side) const {
+    return { side, &header()->requests, static_cast<std::uint8_t*>(base_) + request_offset_,
+             slots_, request_slot_size_ };
+}
+
+SpscRing ShmChannel::responses(SpscRing::Side side) const {
+    return { side, &header()->responses, static_cast<std::uint8_t*>(base_) + response_offset_,
+             slots_, kResponseSlotSize };
+}
+
+void ShmChannel::detach() {
+    if (base_) header()->detached.store(1, std::memory_order_release);
+}
+
+bool ShmChannel::detached() const {
+    return !base_ || header()->detached.load(std::memory_order_acquire) != 0;
+}
+
+// ── ShmClient ────────────────────────────────────────────────────────────────
+
+ShmClient::ShmClient(ShmChannel channel)
+    : channel_(std::move(channel)),
+      requests_(channel_.requests(SpscRing::Side::Producer)),
+      responses_(channel_.responses(SpscRing::Side::Consumer)) {}
+
+ShmClient ShmClient::connect(const std::string& socket_path, std::uint32_t slots) {
+    sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        throw std::invalid_argument("ShmClient: socket path too long");
+    }
+    std::memcpy(addr.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+    ShmClient client(ShmChannel::create(slots));
+    client.control_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (client.control_fd_ < 0) throw_errno("socket");
+    if (::connect(client.control_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        throw_errno("connect");
+    }
+
+    // Hand over the memfd; the server answers one byte once it has mapped it.
+    char byte = 0;
+    iovec iov { &byte, 1 };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr msg {};
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* cmsg   = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type  = SCM_RIGHTS;
+    cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+    const int fd = client.channel_.fd();
+    std::memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+    if (::sendmsg(client.control_fd_, &msg, MSG_NOSIGNAL) < 0) throw_errno("sendmsg");
+    if (::read(client.control_fd_, &byte, 1) != 1) {
+        throw std::system_error(ECONNREFUSED, std::generic_category(), "ShmClient: channel rejected");
+    }
+    return client;
+}
+
+ShmClient::ShmClient(ShmClient&& other) noexcept
+    : channel_(std::move(other.channel_)),
+      requests_(other.requests_),
+      responses_(other.responses_),
+      control_fd_(std::exchange(other.control_fd_, -1)),
+      next_id_(other.next_id_) {}
+
+ShmClient::~ShmClient() {
+    channel_.detach();
+    if (control_fd_ >= 0) ::close(control_fd_);
+}
+
+bool ShmClient::submit(std::uint32_t id, const RequestContext& ctx) {
+    if (wire::request_size(ctx) > requests_.slot_size()) {
+        throw std::length_error("ShmClient: request larger than a ring slot");
+    }
+    std::uint8_t* slot = requests_.try_claim();
+    if (!slot) return false;
+    wire::encode_request(id, ctx, slot, requests_.slot_size());
+    return true;
+}
+
+void ShmClient::flush() {
+    requests_.publish();
+}
+
+bool ShmClient::poll(wire::Response& out) {
+    const std::uint8_t* slot = responses_.try_read();
+    if (!slot) return false;
+    const bool ok = wire::decode_response(slot + wire::kHeaderSize, wire::kResponsePayload, out);
+    responses_.release();
+    if (!ok) out = { out.id, wire::Status::Malformed, Effect::Deny };
+    return true;
+}
+
+bool ShmClient::server_gone() const {
+    if (control_fd_ < 0) return false;
+    // The daemon sends nothing after the handshake, so readable means EOF.
+    pollfd pfd { control_fd_, POLLIN, 0 };
+    return ::poll(&pfd, 1, 0) > 0 && (pfd.revents & (POLLHUP | POLLERR | POLLIN));
+}
+
+Effect ShmClient::decide(const RequestContext& ctx) {
+    const std::uint32_t id = next_id_++;
+    Backoff backoff;
+    const auto wait = [&] {
+        if (backoff.sleeping() && server_gone()) {
+            throw std::system_error(ECONNRESET, std::generic_category(), "ShmClient: server went away");
+        }
+        backoff.pause();
+    };
+
+    while (!submit(id, ctx)) wait();
+    flush();
+
+    backoff.reset();
+    wire::Response response;
+    while (!poll(response)) wait();
+    return response.status == wire::Status::Ok ? response.effect : Effect::Deny;
+}
+
+// ── ShmServer ────────────────────────────────────────────────────────────────
+
+ShmServer::ShmServer(const PolicyEngine& engine, ShmChannel channel, int control_fd)
+    : engine_(engine), channel_(std::move(channel)), control_fd_(control_fd) {}
+
+bool ShmServer::client_gone() const {
+    if (channel_.detached()) return true;
+    if (control_fd_ < 0) return false;
+    pollfd pfd { control_fd_, POLLIN, 0 };
+    return ::poll(&pfd, 1, 0) > 0 && (pfd.revents & (POLLHUP | POLLERR | POLLIN));
+}
+
+void ShmServer::run(const std::atomic<bool>& stop) {
+    SpscRing requests  = channel_.requests(SpscRing::Side::Consumer);
+    SpscRing responses = channel_.responses(SpscRing::Side::Producer);
+    RequestContext ctx;   // reused, so decoding reuses its string storage
+    Backoff backoff;
+
+    while (!stop.load(std::memory_order_relaxed)) {
+        std::size_t served = 0;
+        for (; served < kServerBatch; ++served) {
+            const std::uint8_t* slot = requests.try_read();
+            if (!slot) break;
+
+            // Decode before anything can release the slot back to the client.
+            wire::Response response;
+            const auto length = wire::payload_length(slot, requests.slot_size());
+            try {
+                if (length && *length <= wire::kMaxPayload &&
+                    *length <= requests.slot_size() - wire::kHeaderSize &&
+                    wire::decode_request(slot + wire::kHeaderSize, *length, response.id, ctx)) {
+                    response.effect = engine_.decide(ctx);
+                } else {
+                    response.status = wire::Status::Malformed;
+                }
+            } catch (const std::exception&) {   // denied, not fatal to the channel
+                response.status = wire::Status::Malformed;
+                response.effect = Effect::Deny;
+            }
+
+            std::uint8_t* out;
+            while (!(out = responses.try_claim())) {
+                // Response ring full: hand back what we have and wait for the client.
+                responses.publish();
+                requests.release();
+                if (stop.load(std::memory_order_relaxed) || client_gone()) return;
+                backoff.pause();
+            }
+            wire::encode_response(response, out);
+        }
+
+        if (served) {
+            responses.publish();
+            requests.release();
+            backoff.reset();
+            continue;
+        }
+        if (backoff.sleeping() && client_gone()) return;
+        backoff.pause();
+    }
+}
+
+} // namespace governance
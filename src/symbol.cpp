@@ -0,0 +1,128 @@
+#include "governance/symbol.hpp"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace governance {
+
+namespace {
+
+// Seeded in id order; must match the constants in governance::symbols.
+constexpr std::array<std::string_view, symbols::well_known_count> kWellKnown {
+    "",
+    "admin", "engineer", "analyst", "guest",
+    "database", "storage", "compute", "secret",
+    "public", "internal", "confidential", "restricted",
+    "read", "write", "delete", "execute",
+    "production", "staging", "dev",
+};
+
+// ── SymbolTable ──────────────────────────────────────────────────────────────
+//
+// Strings live in fixed-size chunks that are never moved or freed, so str()
+// can read them without taking the lock: a Symbol's id is only ever observed
+// after the insert that produced it.
+
+class SymbolTable {
+public:
+    static SymbolTable& instance() {
+        // Intentionally leaked: Symbols held in static storage may be printed
+        // during shutdown.
+        static SymbolTable* table = new SymbolTable();
+        return *table;
+    }
+
+    std::uint32_t intern(std::string_view text) {
+        if (auto id = find_well_known(text)) return *id;
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            auto it = index_.find(text);
+            if (it != index_.end()) return it->second;
+        }
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        auto it = index_.find(text);
+        if (it != index_.end()) return it->second;
+        return insert(text);
+    }
+
+    std::optional<std::uint32_t> find(std::string_view text) const {
+        if (auto id = find_well_known(text)) return id;
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = index_.find(text);
+        if (it == index_.end()) return std::nullopt;
+        return it->second;
+    }
+
+    const std::string& str(std::uint32_t id) const {
+        const std::string* chunk = chunks_[id >> kChunkBits].load(std::memory_order_acquire);
+        return chunk[id & (kChunkSize - 1)];
+    }
+
+    std::size_t size() const { return size_.load(std::memory_order_acquire); }
+
+private:
+    static constexpr std::uint32_t kChunkBits = 12;
+    static constexpr std::uint32_t kChunkSize = 1u << kChunkBits;
+    static constexpr std::uint32_t kMaxChunks = 1u << 12;   // 16M symbols
+
+    SymbolTable() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        for (auto text : kWellKnown) insert(text);
+    }
+
+    static std::optional<std::uint32_t> find_well_known(std::string_view text) {
+        for (std::uint32_t id = 0; id < kWellKnown.size(); ++id) {
+            if (kWellKnown[id] == text) return id;
+        }
+        return std::nullopt;
+    }
+
+    // Caller holds the unique lock.
+    std::uint32_t insert(std::string_view text) {
+        const auto id    = static_cast<std::uint32_t>(size_.load(std::memory_order_relaxed));
+        const auto chunk = id >> kChunkBits;
+        if (chunk >= kMaxChunks) throw std::length_error("governance::Symbol table is full");
+
+        std::string* storage = chunks_[chunk].load(std::memory_order_relaxed);
+        if (!storage) {
+            storage = new std::string[kChunkSize];
+            chunks_[chunk].store(storage, std::memory_order_release);
+        }
+        std::string& slot = storage[id & (kChunkSize - 1)];
+        slot.assign(text.data(), text.size());
+        index_.emplace(std::string_view(slot), id);
+        size_.store(id + 1, std::memory_order_release);
+        return id;
+    }
+
+    mutable std::shared_mutex                          mutex_;
+    std::unordered_map<std::string_view, std::uint32_t> index_;
+    std::array<std::atomic<std::string*>, kMaxChunks>   chunks_ {};
+    std::atomic<std::size_t>                            size_ { 0 };
+};
+
+} // namespace
+
+// ── Symbol ───────────────────────────────────────────────────────────────────
+
+Symbol::Symbol(std::string_view text)
+    : id_(SymbolTable::instance().intern(text)) {}
+
+std::optional<Symbol> Symbol::lookup(std::string_view text) {
+    if (auto id = SymbolTable::instance().find(text)) return from_id(*id);
+    return std::nullopt;
+}
+
+std::size_t Symbol::table_size() {
+    return SymbolTable::instance().size();
+}
+
+const std::string& Symbol::str() const {
+    return SymbolTable::instance().str(id_);
+}
+
+} // namespace governance
@@ -0,0 +1,156 @@
+#include "governance/tag_set.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace governance {
+
+// ── TagSet ───────────────────────────────────────────────────────────────────
+
+TagSet::TagSet(std::initializer_list<std::pair<std::string_view, std::string_view>> tags) {
+    for (const auto& [key, value] : tags) set(key, value);
+}
+
+TagSet::TagSet(const std::unordered_map<std::string, std::string>& tags) {
+    for (const auto& [key, value] : tags) set(key, value);
+}
+
+std::size_t TagSet::index_of_spilled(Symbol key) const {
+    const auto it = std::lower_bound(spill_.begin(), spill_.end(), key,
+                                     [](const Entry& e, Symbol k) { return e.key < k; });
+    return it != spill_.end() && it->key == key ? static_cast<std::size_t>(it - spill_.begin()) : size_;
+}
+
+std::size_t TagSet::index_of_text(std::string_view key) const {
+    const Entry* e = entries();
+    for (std::size_t i = 0; i < size_; ++i) {
+        if (e[i].key.str() == key) return i;
+    }
+    return size_;
+}
+
+std::string_view TagSet::at(const TagKey& key) const {
+    const auto i = index_of(key);
+    if (i == size_) throw std::out_of_range("TagSet::at: no such tag");
+    const Entry& e = entries()[i];
+    return { values_.data() + e.offset, e.size };
+}
+
+std::uint32_t TagSet::append_value(std::string_view value) {
+    if (values_.size() + value.size() > std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("TagSet: tag values exceed 4 GiB");
+    const auto offset = static_cast<std::uint32_t>(values_.size());
+    values_.append(value.data(), value.size());
+    return offset;
+}
+
+void TagSet::set(Symbol key, std::string_view value) {
+    // The value may view this set's own storage, which appending can move.
+    std::string copy;
+    if (value.data() >= values_.data() && value.data() < values_.data() + values_.size()) {
+        copy.assign(value.data(), value.size());
+        value = copy;
+    }
+
+    const auto i = index_of(key);
+    if (i != size_) {
+        Entry& e = entries()[i];
+        if (value.size() <= e.size) {
+            values_.replace(e.offset, value.size(), value.data(), value.size());
+            dead_ += e.size - static_cast<std::uint32_t>(value.size());
+        } else {
+            dead_ += e.size;
+            e.offset = append_value(value);
+        }
+        e.size = static_cast<std::uint32_t>(value.size());
+        if (dead_ > values_.size() / 2) compact();
+        return;
+    }
+
+    const Entry entry { key, append_value(value), static_cast<std::uint32_t>(value.size()) };
+    if (size_ == kInlineTags) spill_.assign(inline_, inline_ + kInlineTags);
+    if (size_ >= kInlineTags) {
+        const auto pos = std::upper_bound(spill_.begin(), spill_.end(), key,
+                                          [](Symbol k, const Entry& e) { return k < e.key; });
+        spill_.insert(pos, entry);
+    } else {
+        Entry* pos = std::upper_bound(inline_, inline_ + size_, key,
+                                      [](Symbol k, const Entry& e) { return k < e.key; });
+        std::copy_backward(pos, inline_ + size_, inline_ + size_ + 1);
+        *pos = entry;
+    }
+    ++size_;
+}
+
+std::size_t TagSet::erase(const TagKey& key) {
+    const auto i = index_of(key);
+    if (i == size_) return 0;
+    if (size_ > kInlineTags) {
+        dead_ += spill_[i].size;
+        spill_.erase(spill_.begin() + static_cast<std::ptrdiff_t>(i));
+        if (spill_.size() == kInlineTags) {
+            std::copy(spill_.begin(), spill_.end(), inline_);
+            spill_.clear();
+        }
+    } else {
+        dead_ += inline_[i].size;
+        std::copy(inline_ + i + 1, inline_ + size_, inline_ + i);
+    }
+    --size_;
+    if (size_ == 0) {
+        clear();
+    } else if (dead_ > values_.size() / 2) {
+        compact();
+    }
+    return 1;
+}
+
+void TagSet::clear() {
+    size_ = 0;
+    dead_ = 0;
+    spill_.clear();
+    values_.clear();
+}
+
+void TagSet::compact() {
+    // Slide the live values down in offset order, keeping the capacity for
+    // the next set().
+    Entry*              inline_order[kInlineTags];
+    std::vector<Entry*> spill_order;
+    Entry**             order = inline_order;
+    if (size_ > kInlineTags) {
+        spill_order.resize(size_);
+        order = spill_order.data();
+    }
+    Entry* e = entries();
+    for (std::size_t i = 0; i < size_; ++i) order[i] = &e[i];
+    std::sort(order, order + size_, [](const Entry* a, const Entry* b) { return a->offset < b->offset; });
+
+    std::uint32_t end = 0;
+    for (std::size_t i = 0; i < size_; ++i) {
+        Entry& entry = *order[i];
+        if (entry.offset != end) std::memmove(&values_[end], &values_[entry.offset], entry.size);
+        entry.offset = end;
+        end += entry.size;
+    }
+    values_.resize(end);
+    dead_ = 0;
+}
+
+std::unordered_map<std::string, std::string> TagSet::to_map() const {
+    std::unordered_map<std::string, std::string> map;
+    map.reserve(size_);
+    for (const auto& [key, value] : *this) map.emplace(key.str(), value);
+    return map;
+}
+
+bool operator==(const TagSet& a, const TagSet& b) {
+    if (a.size_ != b.size_) return false;
+    return std::equal(a.begin(), a.end(), b.begin(), [](const TagSet::Tag& x, const TagSet::Tag& y) {
+        return x.key == y.key && x.value == y.value;
+    });
+}
+
+} // namespace governance
@@ -0,0 +1,94 @@
+#include "governance/thread_pool.hpp"
+
+#include <algorithm>
+
+namespace governance {
+
+ThreadPool::ThreadPool(std::size_t concurrency) {
+    if (concurrency == 0) concurrency = std::max(1u, std::thread::hardware_concurrency());
+    workers_.reserve(concurrency - 1);
+    for (std::size_t i = 1; i < concurrency; ++i)
+        workers_.emplace_back([this] { worker_loop(); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& w : workers_) w.join();
+}
+
+void ThreadPool::parallel_for(std::size_t count, std::size_t chunk, const RangeFn& fn) {
+    if (count == 0) return;
+    chunk = std::max<std::size_t>(chunk, 1);
+
+    std::unique_lock<std::mutex> submit(submit_mutex_, std::try_to_lock);
+    if (workers_.empty() || count <= chunk || !submit.owns_lock()) {
+        fn(0, count);
+        return;
+    }
+
+    Job job;
+    job.fn    = &fn;
+    job.count = count;
+    job.chunk = chunk;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &job;
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    run_chunks(job);
+
+    // Retire the job so late-waking workers skip it, then wait for the ones
+    // that picked it up.
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        job_ = nullptr;
+        done_.wait(lock, [this] { return active_ == 0; });
+    }
+    if (job.error) std::rethrow_exception(job.error);
+}
+
+void ThreadPool::worker_loop() {
+    std::uint64_t seen = 0;
+    for (;;) {
+        Job* job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+            if (!job_) continue;
+            job = job_;
+            ++active_;
+        }
+
+        run_chunks(*job);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--active_ == 0) done_.notify_all();
+    }
+}
+
+void ThreadPool::run_chunks(Job& job) {
+    for (;;) {
+        const std::size_t begin = job.next.fetch_add(job.chunk, std::memory_order_relaxed);
+        if (begin >= job.count) return;
+        const std::size_t end = std::min(begin + job.chunk, job.count);
+        try {
+            (*job.fn)(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(job.error_mutex);
+            if (!job.error) job.error = std::current_exception();
+            // Drain the cursor so other threads stop picking up work.
+            job.next.store(job.count, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+} // namespace governance
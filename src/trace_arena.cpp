@@ -0,0 +1,71 @@
+#include "governance/trace_arena.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace governance {
+
+// ── TraceArena ───────────────────────────────────────────────────────────────
+
+TraceArena::TraceArena(std::size_t block_size)
+    : block_size_(std::max<std::size_t>(block_size, 64)) {}
+
+void* TraceArena::allocate(std::size_t size, std::size_t alignment) {
+    // Blocks come from operator new[], so offsets aligned within a block are
+    // aligned in memory for any alignment up to the default new alignment.
+    while (current_ < blocks_.size()) {
+        Block&            block   = blocks_[current_];
+        const std::size_t aligned = (offset_ + alignment - 1) & ~(alignment - 1);
+        if (aligned + size <= block.size) {
+            offset_ = aligned + size;
+            return block.data.get() + aligned;
+        }
+        if (current_ + 1 == blocks_.size()) break;
+        retired_ += block.size;
+        ++current_;
+        offset_ = 0;
+    }
+
+    // Out of blocks: append one large enough for this request.
+    if (!blocks_.empty()) retired_ += blocks_[current_].size;
+    const std::size_t bytes = std::max(block_size_, size + alignment);
+    blocks_.push_back({ std::make_unique<std::byte[]>(bytes), bytes });
+    current_ = blocks_.size() - 1;
+    offset_  = size;
+    return blocks_.back().data.get();
+}
+
+std::string_view TraceArena::store(std::string_view text) {
+    if (text.empty()) return {};
+    auto* data = static_cast<char*>(allocate(text.size(), 1));
+    std::memcpy(data, text.data(), text.size());
+    return { data, text.size() };
+}
+
+void TraceArena::reset() {
+    current_ = 0;
+    offset_  = 0;
+    retired_ = 0;
+}
+
+std::size_t TraceArena::bytes_used() const {
+    return retired_ + offset_;
+}
+
+std::size_t TraceArena::bytes_reserved() const {
+    std::size_t total = 0;
+    for (const auto& b : blocks_) total += b.size;
+    return total;
+}
+
+// ── Owning conversions ───────────────────────────────────────────────────────
+
+EvaluationTrace TraceView::to_trace() const {
+    EvaluationTrace trace;
+    if (context) trace.context = *context;
+    trace.steps.reserve(step_count);
+    for (const auto& s : *this) trace.steps.push_back(s.to_step());
+    return trace;
+}
+
+} // namespace governance
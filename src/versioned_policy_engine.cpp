@@ -0,0 +1,126 @@
+#include "governance/versioned_policy_engine.hpp"
+#include "governance/trace_arena.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace governance {
+
+namespace {
+
+std::atomic<std::uint64_t> g_next_engine_id { 1 };
+
+constexpr std::size_t kThreadSlots = 4;
+
+} // namespace
+
+// Shared by the thread that caches it and the engine's threads_ list: the
+// thread reads it without locking, the engine clears it on destruction. Only
+// the owning thread touches version and snapshot while the engine is alive.
+struct VersionedPolicyEngine::ThreadSnapshot {
+    std::uint64_t                       version = 0;   // 0: nothing cached yet
+    std::shared_ptr<const PolicyEngine> snapshot;
+    std::atomic<bool>                   released { false };   // the engine is gone
+};
+
+VersionedPolicyEngine::VersionedPolicyEngine(PolicyEngine initial)
+    : id_(g_next_engine_id.fetch_add(1, std::memory_order_relaxed)),
+      current_(std::make_shared<const PolicyEngine>(std::move(initial))) {}
+
+VersionedPolicyEngine::~VersionedPolicyEngine() {
+    // No thread may be using the engine now, so each entry's snapshot is free
+    // to drop; the threads erase the released entries at their next miss.
+    for (const auto& weak : threads_) {
+        if (const auto entry = weak.lock()) {
+            entry->snapshot.reset();
+            entry->released.store(true, std::memory_order_release);
+        }
+    }
+}
+
+VersionedPolicyEngine::ThreadSnapshot& VersionedPolicyEngine::thread_snapshot() const {
+    // Per-thread cache: a direct-mapped front by engine id, backed by a map
+    // holding the thread's entry for every engine it uses. Ids are never
+    // reused, so a slot left behind by a destroyed engine can never match,
+    // and engines whose ids collide fall back to the map, not to the mutex.
+    struct Slot {
+        std::uint64_t   engine = 0;
+        ThreadSnapshot* entry  = nullptr;
+    };
+    struct Cache {
+        Slot slots[kThreadSlots];
+        std::unordered_map<std::uint64_t, std::shared_ptr<ThreadSnapshot>> entries;
+    };
+    thread_local Cache cache;
+
+    Slot& slot = cache.slots[id_ % kThreadSlots];
+    if (slot.engine == id_) return *slot.entry;
+
+    auto it = cache.entries.find(id_);
+    if (it == cache.entries.end()) {
+        // First use of this engine on this thread: forget destroyed engines,
+        // then register with this one so its destructor can reach the entry.
+        for (auto e = cache.entries.begin(); e != cache.entries.end();) {
+            if (e->second->released.load(std::memory_order_acquire)) {
+                e = cache.entries.erase(e);
+            } else {
+                ++e;
+            }
+        }
+        auto entry = std::make_shared<ThreadSnapshot>();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            threads_.erase(std::remove_if(threads_.begin(), threads_.end(),
+                                          [](const std::weak_ptr<ThreadSnapshot>& w) { return w.expired(); }),
+                           threads_.end());
+            threads_.push_back(entry);
+        }
+        it = cache.entries.emplace(id_, std::move(entry)).first;
+    }
+    slot = { id_, it->second.get() };
+    return *slot.entry;
+}
+
+const PolicyEngine& VersionedPolicyEngine::current() const {
+    const auto version = version_.load(std::memory_order_acquire);
+    ThreadSnapshot& local = thread_snapshot();
+    if (local.version == version) return *local.snapshot;
+
+    // Slow path, once per thread per version. Reading both fields under the
+    // writers' lock keeps them consistent; replacing the snapshot releases
+    // this thread's reference to the previous one.
+    std::lock_guard<std::mutex> lock(mutex_);
+    local.version  = version_.load(std::memory_order_relaxed);
+    local.snapshot = current_;
+    return *local.snapshot;
+}
+
+EvaluationView VersionedPolicyEngine::evaluate(const RequestContext& ctx, TraceArena& arena) const {
+    return current().evaluate(ctx, arena);
+}
+
+std::shared_ptr<const PolicyEngine> VersionedPolicyEngine::snapshot() const {
+    current();
+    return thread_snapshot().snapshot;
+}
+
+std::uint64_t VersionedPolicyEngine::publish(PolicyEngine next) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    return publish_locked(std::move(next));
+}
+
+std::uint64_t VersionedPolicyEngine::publish_locked(PolicyEngine next) {
+    // Allocate before and free after the readers' lock, so it covers the
+    // swap alone; the old snapshot may be the last reference to its engine.
+    auto snapshot = std::make_shared<const PolicyEngine>(std::move(next));
+    std::uint64_t version;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        current_.swap(snapshot);
+        version = version_.load(std::memory_order_relaxed) + 1;
+        version_.store(version, std::memory_order_release);
+    }
+    return version;
+}
+
+} // namespace governance
@@ -0,0 +1,229 @@
+#include "governance/wire.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace governance::wire {
+
+namespace {
+
+// ── Encoding ─────────────────────────────────────────────────────────────────
+
+// Writes into memory the caller has already sized; see request_size().
+class Writer {
+public:
+    explicit Writer(std::uint8_t* p) : p_(p) {}
+
+    void u8(std::uint8_t v) { *p_++ = v; }
+    void u16(std::uint16_t v) {
+        *p_++ = static_cast<std::uint8_t>(v);
+        *p_++ = static_cast<std::uint8_t>(v >> 8);
+    }
+    void u32(std::uint32_t v) {
+        for (int shift = 0; shift < 32; shift += 8) *p_++ = static_cast<std::uint8_t>(v >> shift);
+    }
+    void str8(std::string_view s) {
+        u8(static_cast<std::uint8_t>(s.size()));
+        raw(s);
+    }
+    void str16(std::string_view s) {
+        u16(static_cast<std::uint16_t>(s.size()));
+        raw(s);
+    }
+
+private:
+    void raw(std::string_view s) {
+        if (!s.empty()) std::memcpy(p_, s.data(), s.size());
+        p_ += s.size();
+    }
+    std::uint8_t* p_;
+};
+
+std::size_t str8_size(std::string_view s) {
+    if (s.size() > UINT8_MAX) throw std::length_error("wire: attribute value longer than 255 bytes");
+    return 1 + s.size();
+}
+
+std::size_t str16_size(std::string_view s) {
+    if (s.size() > UINT16_MAX) throw std::length_error("wire: field longer than 65535 bytes");
+    return 2 + s.size();
+}
+
+// ── Decoding ─────────────────────────────────────────────────────────────────
+
+class Reader {
+public:
+    Reader(const std::uint8_t* data, std::size_t size) : p_(data), end_(data + size) {}
+
+    bool u8(std::uint8_t& v) {
+        if (end_ - p_ < 1) return false;
+        v = *p_++;
+        return true;
+    }
+    bool u16(std::uint16_t& v) {
+        if (end_ - p_ < 2) return false;
+        v = static_cast<std::uint16_t>(p_[0] | (p_[1] << 8));
+        p_ += 2;
+        return true;
+    }
+    bool u32(std::uint32_t& v) {
+        if (end_ - p_ < 4) return false;
+        v = static_cast<std::uint32_t>(p_[0]) | static_cast<std::uint32_t>(p_[1]) << 8 |
+            static_cast<std::uint32_t>(p_[2]) << 16 | static_cast<std::uint32_t>(p_[3]) << 24;
+        p_ += 4;
+        return true;
+    }
+    bool bytes(std::size_t n, std::string_view& v) {
+        if (static_cast<std::size_t>(end_ - p_) < n) return false;
+        v = { reinterpret_cast<const char*>(p_), n };
+        p_ += n;
+        return true;
+    }
+    bool str8(std::string_view& v) {
+        std::uint8_t n;
+        return u8(n) && bytes(n, v);
+    }
+    bool str16(std::string_view& v) {
+        std::uint16_t n;
+        return u16(n) && bytes(n, v);
+    }
+    bool symbol(Symbol& v) {
+        std::string_view text;
+        if (!str8(text)) return false;
+        v = Symbol::lookup(text).value_or(Symbol());
+        return true;
+    }
+    bool string(std::string& v) {
+        std::string_view text;
+        if (!str16(text)) return false;
+        v.assign(text.data(), text.size());
+        return true;
+    }
+    bool done() const { return p_ == end_; }
+
+private:
+    const std::uint8_t* p_;
+    const std::uint8_t* end_;
+};
+
+} // namespace
+
+// ── Frames ───────────────────────────────────────────────────────────────────
+
+std::optional<std::uint32_t> payload_length(const std::uint8_t* data, std::size_t size) {
+    std::uint32_t length;
+    Reader reader(data, size);
+    if (!reader.u32(length)) return std::nullopt;
+    return length;
+}
+
+// ── Requests ─────────────────────────────────────────────────────────────────
+
+std::size_t request_size(const RequestContext& ctx) {
+    std::size_t size = kHeaderSize + 4 + 1;
+    size += str8_size(ctx.principal.role.str());
+    size += str8_size(ctx.resource.type.str());
+    size += str8_size(ctx.resource.classification.str());
+    size += str8_size(ctx.action.verb.str());
+    size += str8_size(ctx.environment.str());
+    size += str16_size(ctx.principal.id);
+    size += str16_size(ctx.principal.department);
+    size += str16_size(ctx.resource.id);
+    if (ctx.resource.tags.size() > UINT16_MAX) throw std::length_error("wire: too many tags");
+    size += 2;
+    for (const auto& [key, value] : ctx.resource.tags) size += str16_size(key.str()) + str16_size(value);
+    if (size - kHeaderSize > kMaxPayload) throw std::length_error("wire: request larger than kMaxPayload");
+    return size;
+}
+
+std::size_t encode_request(std::uint32_t id, const RequestContext& ctx,
+                           std::uint8_t* out, std::size_t capacity) {
+    const std::size_t size = request_size(ctx);
+    if (size > capacity) return 0;
+
+    Writer w(out);
+    w.u32(static_cast<std::uint32_t>(size - kHeaderSize));
+    w.u32(id);
+    w.u8(ctx.mfa_verified ? 1 : 0);
+    w.str8(ctx.principal.role.str());
+    w.str8(ctx.resource.type.str());
+    w.str8(ctx.resource.classification.str());
+    w.str8(ctx.action.verb.str());
+    w.str8(ctx.environment.str());
+    w.str16(ctx.principal.id);
+    w.str16(ctx.principal.department);
+    w.str16(ctx.resource.id);
+    w.u16(static_cast<std::uint16_t>(ctx.resource.tags.size()));
+    for (const auto& [key, value] : ctx.resource.tags) {
+        w.str16(key.str());
+        w.str16(value);
+    }
+    return size;
+}
+
+void encode_request(std::uint32_t id, const RequestContext& ctx, std::vector<std::uint8_t>& out) {
+    const std::size_t start = out.size();
+    const std::size_t size  = request_size(ctx);
+    out.resize(start + size);
+    encode_request(id, ctx, out.data() + start, size);
+}
+
+bool decode_request(const std::uint8_t* payload, std::size_t size,
+                    std::uint32_t& id, RequestContext& ctx) {
+    Reader in(payload, size);
+    std::uint8_t flags;
+    if (!in.u32(id) || !in.u8(flags)) return false;
+    ctx.mfa_verified = (flags & 1) != 0;
+
+    if (!in.symbol(ctx.principal.role) || !in.symbol(ctx.resource.type) ||
+        !in.symbol(ctx.resource.classification) || !in.symbol(ctx.action.verb) ||
+        !in.symbol(ctx.environment)) {
+        return false;
+    }
+    if (!in.string(ctx.principal.id) || !in.string(ctx.principal.department) ||
+        !in.string(ctx.resource.id)) {
+        return false;
+    }
+
+    std::uint16_t tags;
+    if (!in.u16(tags)) return false;
+    ctx.resource.tags.clear();
+    for (std::uint16_t i = 0; i < tags; ++i) {
+        std::string_view key, value;
+        if (!in.str16(key) || !in.str16(value)) return false;
+        // Like the attribute symbols above, tag keys are only looked up: a
+        // key nothing has interned is dropped, as no policy or rule names it.
+        if (const auto symbol = Symbol::lookup(key)) ctx.resource.tags.set(*symbol, value);
+    }
+    return in.done();
+}
+
+// ── Responses ────────────────────────────────────────────────────────────────
+
+void encode_response(const Response& response, std::uint8_t* out) {
+    Writer w(out);
+    w.u32(static_cast<std::uint32_t>(kResponsePayload));
+    w.u32(response.id);
+    w.u8(static_cast<std::uint8_t>(response.status));
+    w.u8(response.effect == Effect::Allow ? 0 : 1);
+}
+
+void encode_response(const Response& response, std::vector<std::uint8_t>& out) {
+    const std::size_t start = out.size();
+    out.resize(start + kResponseSize);
+    encode_response(response, out.data() + start);
+}
+
+bool decode_response(const std::uint8_t* payload, std::size_t size, Response& out) {
+    Reader in(payload, size);
+    std::uint8_t status, effect;
+    if (!in.u32(out.id) || !in.u8(status) || !in.u8(effect) || !in.done()) return false;
+    if (status > static_cast<std::uint8_t>(Status::Malformed) || effect > 1) return false;
+    out.status = static_cast<Status>(status);
+    out.effect = effect == 0 ? Effect::Allow : Effect::Deny;
+    return true;
+}
+
+} // namespace governance::wire
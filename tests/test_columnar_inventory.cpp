@@ -0,0 +1,162 @@
+#include "governance/columnar_inventory.hpp"
+#include "governance/compliance.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+// Types and classifications cycle so every default rule passes and fails
+// somewhere; every third resource lacks an owner, every fifth has a region.
+static std::vector<Resource> make_inventory(std::size_t n) {
+    const char* types[]           = { "database", "storage", "secret", "compute" };
+    const char* classifications[] = { "public", "restricted", "confidential", "" };
+    std::vector<Resource> inventory;
+    inventory.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        Resource r { "res-" + std::to_string(i), types[i % 4], classifications[(i / 4) % 4], {} };
+        if (i % 3) r.tags.set("owner", "team-" + std::to_string(i % 7));
+        if (i % 5 == 0) r.tags.set("region", "eu-" + std::to_string(i % 2));
+        inventory.push_back(std::move(r));
+    }
+    return inventory;
+}
+
+static bool same_summary(const ComplianceSummary& a, const ComplianceSummary& b) {
+    if (a.resources != b.resources || a.rules.size() != b.rules.size()) return false;
+    for (std::size_t i = 0; i < a.rules.size(); ++i) {
+        if (a.rules[i].rule_name != b.rules[i].rule_name ||
+            a.rules[i].violations != b.rules[i].violations) {
+            return false;
+        }
+    }
+    return a.non_compliant == b.non_compliant;
+}
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_columns() {
+    std::cout << "\n[Columns]\n";
+    const auto resources = make_inventory(130);
+    const ColumnarInventory inventory(resources);
+
+    ASSERT_EQ("size", resources.size(), inventory.size());
+    ASSERT_EQ("words round up", static_cast<std::size_t>(3), inventory.words());
+    ASSERT_EQ("id column", std::string("res-129"), inventory.id(129));
+    ASSERT_EQ("type column holds symbol ids", resources[2].type.id(), inventory.types()[2]);
+    ASSERT_EQ("classification column", resources[12].classification.id(), inventory.classifications()[12]);
+    ASSERT_EQ("padding rows are the empty symbol", static_cast<std::uint32_t>(0),
+              inventory.types()[3 * ColumnarInventory::kRowsPerWord - 1]);
+
+    const std::uint64_t* owner = inventory.tag_bitmap("owner");
+    bool bits_match = owner != nullptr;
+    for (std::size_t r = 0; bits_match && r < resources.size(); ++r)
+        bits_match = ((owner[r / 64] >> (r % 64)) & 1) == resources[r].tags.count("owner");
+    ASSERT_TRUE("owner bitmap matches tags", bits_match);
+    ASSERT_TRUE("unknown tag has no bitmap", inventory.tag_bitmap("cost-center") == nullptr);
+
+    bool rows_match = true;
+    for (std::size_t r = 0; r < resources.size(); ++r) {
+        const Resource row = inventory.row(r);
+        rows_match = rows_match && row.id == resources[r].id && row.type == resources[r].type &&
+                     row.classification == resources[r].classification && row.tags == resources[r].tags;
+    }
+    ASSERT_TRUE("rows round-trip", rows_match);
+}
+
+void test_late_tag_key() {
+    std::cout << "\n[LateTagKey]\n";
+    // A key first seen after several words still gets a bitmap covering them.
+    ColumnarInventory inventory;
+    for (std::size_t i = 0; i < 200; ++i) inventory.append({ "r" + std::to_string(i), "storage", "public", {} });
+    inventory.append({ "late", "storage", "public", {{"owner", "t"}} });
+
+    const std::uint64_t* owner = inventory.tag_bitmap("owner");
+    ASSERT_TRUE("bitmap exists", owner != nullptr);
+    ASSERT_EQ("earlier words clear", static_cast<std::uint64_t>(0), owner[0] | owner[1] | owner[2]);
+    ASSERT_EQ("late row set", std::uint64_t { 1 } << (200 % 64), owner[200 / 64]);
+    ASSERT_EQ("late row value", std::string("t"), inventory.row(200).tags.at("owner"));
+}
+
+void test_summarize_matches_rows() {
+    std::cout << "\n[SummarizeMatchesRows]\n";
+    auto checker = default_compliance_checker();
+    for (std::size_t n : { 0, 1, 63, 64, 65, 10000 }) {
+        const auto resources = make_inventory(n);
+        const ColumnarInventory inventory(resources);
+        ASSERT_TRUE("default rules, " + std::to_string(n) + " rows",
+                    same_summary(checker.summarize(resources), checker.summarize(inventory)));
+    }
+
+    checker.set_concurrency(4);
+    const auto resources = make_inventory(100000 + 17);
+    const ColumnarInventory inventory(resources);
+    ASSERT_TRUE("default rules, 4 threads",
+                same_summary(checker.summarize(resources), checker.summarize(inventory)));
+}
+
+void test_rule_without_kernel() {
+    std::cout << "\n[RuleWithoutKernel]\n";
+    // Mixes kernel rules with one that only has a row check.
+    auto checker = default_compliance_checker();
+    checker.add_rule({ "RequiresEuRegion", "1.0", "test", "Region must be in the EU.",
+                       [](const Resource& r) {
+                           auto it = r.tags.find("region");
+                           return it != r.tags.end() && it->value.rfind("eu-", 0) == 0;
+                       } });
+    checker.set_concurrency(3);
+
+    const auto resources = make_inventory(5000);
+    const ColumnarInventory inventory(resources);
+    const auto summary = checker.summarize(inventory);
+    ASSERT_TRUE("falls back to check() on rebuilt rows",
+                same_summary(checker.summarize(resources), summary));
+    ASSERT_EQ("fallback rule counted", static_cast<std::uint64_t>(5000 - 1000),
+              summary.rules.back().violations);
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Columnar Inventory Tests ===\n";
+
+    test_columns();
+    test_late_tag_key();
+    test_summarize_matches_rows();
+    test_rule_without_kernel();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
@@ -1,11 +1,31 @@
 #include "governance/compliance.hpp"
 #include "governance/json.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace governance;
 
+// A varied inventory: every third resource lacks an owner, and types and
+// classifications cycle so every rule passes and fails somewhere.
+static std::vector<Resource> make_inventory(std::size_t n) {
+    const char* types[]           = { "database", "storage", "secret", "compute" };
+    const char* classifications[] = { "public", "restricted", "confidential", "" };
+    std::vector<Resource> inventory;
+    inventory.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        Resource r { "res-" + std::to_string(i), types[i % 4], classifications[(i / 4) % 4], {} };
+        if (i % 3) r.tags.set("owner", "team-" + std::to_string(i % 7));
+        inventory.push_back(std::move(r));
+    }
+    return inventory;
+}
+
 static int passed = 0;
 static int failed = 0;
 
@@ -62,7 +82,7 @@ void test_missing_owner_tag() {
 
     bool found = false;
     for (const auto& v : report.violations)
-        if (v.find("RequiresOwnerTag") != std::string::npos) found = true;
+        if (v.name == "RequiresOwnerTag") found = true;
     ASSERT_TRUE("RequiresOwnerTag violation present", found);
 }
 
@@ -76,7 +96,7 @@ void test_secret_classified_public() {
 
     bool found = false;
     for (const auto& v : report.violations)
-        if (v.find("SecretsNotPublic") != std::string::npos) found = true;
+        if (v.name == "SecretsNotPublic") found = true;
     ASSERT_TRUE("SecretsNotPublic violation present", found);
 
     // Non-secret public resource is fine
@@ -111,7 +131,7 @@ void test_no_unclassified_resources() {
 
     bool found = false;
     for (const auto& v : report.violations)
-        if (v.find("NoUnclassifiedResources") != std::string::npos) found = true;
+        if (v.name == "NoUnclassifiedResources") found = true;
     ASSERT_TRUE("NoUnclassifiedResources violation present", found);
 }
 
@@ -147,6 +167,104 @@ void test_custom_rule() {
                 !checker.evaluate(without_region).compliant());
 }
 
+void test_violation_records() {
+    std::cout << "\n[ViolationRecords]\n";
+    ComplianceReport report;
+    {
+        ComplianceChecker checker;
+        checker.add_rule({ "First",  "1.0", "test", "Always passes.", [](const Resource&) { return true; } });
+        checker.add_rule({ "Second", "1.0", "test", "Always fails.",  [](const Resource&) { return false; } });
+        report = checker.evaluate(Resource { "svc", "compute", "internal", {} });
+    }
+    // The checker is gone; the record still names and describes its rule.
+    ASSERT_EQ("one violation", static_cast<std::size_t>(1), report.violations.size());
+    const Violation& v = report.violations.front();
+    ASSERT_EQ("rule index", static_cast<std::uint32_t>(1), v.rule);
+    ASSERT_TRUE("rule name", v.name == "Second");
+    ASSERT_TRUE("rule description", v.description == "Always fails.");
+    ASSERT_EQ("formatted text", std::string("[Second] Always fails."), v.str());
+
+    std::ostringstream os;
+    os << v;
+    ASSERT_EQ("operator<< matches str()", v.str(), os.str());
+    ASSERT_TRUE("to_json prints the formatted text",
+                to_json(report).find("\"[Second] Always fails.\"") != std::string::npos);
+}
+
+void test_early_exit_modes() {
+    std::cout << "\n[EarlyExitModes]\n";
+    auto checker = default_compliance_checker();
+
+    Resource ok    { "db-ok",     "database", "restricted", {{"owner", "t"}} };
+    Resource rogue { "db-legacy", "database", "public",     {} };
+
+    ASSERT_TRUE("is_compliant(compliant)", checker.is_compliant(ok));
+    ASSERT_TRUE("is_compliant(rogue) is false", !checker.is_compliant(rogue));
+    ASSERT_TRUE("first_violation(compliant) is empty", !checker.first_violation(ok).has_value());
+    const auto first = checker.first_violation(rogue);
+    ASSERT_TRUE("first_violation in registration order",
+                first.has_value() && first->name == "RequiresOwnerTag");
+    ASSERT_EQ("count_violations(rogue)", static_cast<std::size_t>(2), checker.count_violations(rogue));
+    ASSERT_EQ("count_violations(compliant)", static_cast<std::size_t>(0), checker.count_violations(ok));
+
+    // Every mode agrees with evaluate() across a varied inventory.
+    bool agree = true;
+    for (const auto& r : make_inventory(2000)) {
+        const auto report = checker.evaluate(r);
+        const auto v      = checker.first_violation(r);
+        agree = agree && checker.is_compliant(r) == report.compliant() &&
+                checker.count_violations(r) == report.violations.size() &&
+                v.has_value() == !report.compliant() &&
+                (!v || std::find(report.violations.begin(), report.violations.end(), *v) !=
+                           report.violations.end());
+    }
+    ASSERT_TRUE("modes agree with evaluate()", agree);
+}
+
+void test_rule_ordering() {
+    std::cout << "\n[RuleOrdering]\n";
+    // Three rules counting their invocations: "Slow" is expensive and never
+    // fails, "Rare" is cheap and rarely fails, "Often" is cheap and often fails.
+    std::size_t calls[3] = {};
+    ComplianceChecker checker;
+    checker.add_rule({ "Slow", "1.0", "test", "Slow.",
+                       [&](const Resource&) { ++calls[0]; return true; }, 10 });
+    checker.add_rule({ "Rare", "1.0", "test", "Rare.",
+                       [&](const Resource& r) { ++calls[1]; return r.id != "res-0"; } });
+    checker.add_rule({ "Often", "1.0", "test", "Often.",
+                       [&](const Resource& r) { ++calls[2]; return r.tags.count("owner") > 0; } });
+
+    const std::vector<std::uint32_t> registration { 0, 1, 2 };
+    ASSERT_TRUE("registration order by default", checker.rule_order() == registration);
+
+    checker.order_rules();
+    const std::vector<std::uint32_t> by_cost { 1, 2, 0 };
+    ASSERT_TRUE("order_rules() sorts by cost, stably", checker.rule_order() == by_cost);
+
+    const auto inventory = make_inventory(300);
+    checker.order_rules(checker.summarize(inventory));
+    const std::vector<std::uint32_t> by_failure { 2, 1, 0 };
+    ASSERT_TRUE("order_rules(summary) puts frequent failures first", checker.rule_order() == by_failure);
+
+    std::fill(std::begin(calls), std::end(calls), 0);
+    const auto first = checker.first_violation(inventory[3]);   // no owner tag
+    ASSERT_TRUE("first_violation follows rule_order()", first && first->name == "Often");
+    ASSERT_EQ("early exit skips the remaining rules", static_cast<std::size_t>(0), calls[0] + calls[1]);
+
+    const auto report = checker.evaluate(inventory[0]);   // fails Rare and Often
+    ASSERT_TRUE("evaluate() still reports in registration order",
+                report.violations.size() == 2 && report.violations[0].name == "Rare" &&
+                report.violations[1].name == "Often");
+
+    bool threw = false;
+    try {
+        checker.order_rules(default_compliance_checker().summarize(inventory));
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    ASSERT_TRUE("mismatched summary rejected", threw);
+}
+
 void test_rule_count() {
     std::cout << "\n[RuleCount]\n";
     auto checker = default_compliance_checker();
@@ -165,6 +283,128 @@ void test_json_compliance_report() {
     ASSERT_TRUE("json contains violations key",  json.find("violations")   != std::string::npos);
 }
 
+void test_scan_matches_evaluate() {
+    std::cout << "\n[ScanMatchesEvaluate]\n";
+    auto checker = default_compliance_checker();
+    const auto inventory = make_inventory(20000);
+
+    std::vector<std::vector<Violation>> expected;
+    for (const auto& r : inventory) expected.push_back(checker.evaluate(r).violations);
+
+    for (std::size_t threads : { 1, 4 }) {
+        checker.set_concurrency(threads);
+        const auto reports = checker.scan(inventory);
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < reports.size(); ++i) {
+            if (reports[i].resource_id != inventory[i].id || reports[i].violations != expected[i])
+                ++mismatches;
+        }
+        ASSERT_EQ("scan x" + std::to_string(threads) + " in input order, equal to evaluate()",
+                  static_cast<std::size_t>(0), mismatches);
+    }
+    ASSERT_EQ("concurrency reported", static_cast<std::size_t>(4), checker.concurrency());
+    ASSERT_TRUE("empty scan", checker.scan(std::vector<Resource>{}).empty());
+}
+
+void test_scan_sink() {
+    std::cout << "\n[ScanSink]\n";
+    auto checker = default_compliance_checker();
+    checker.set_concurrency(3);
+    // Longer than one window, and not a multiple of it.
+    const auto inventory = make_inventory(ComplianceChecker::kScanWindow * 3 * 2 + 123);
+
+    std::size_t next = 0, out_of_order = 0, violations = 0, expected_violations = 0;
+    checker.scan(inventory, [&](std::size_t index, ComplianceReport&& report) {
+        if (index != next++ || report.resource_id != inventory[index].id) ++out_of_order;
+        violations += report.violations.size();
+    });
+    for (const auto& r : inventory) expected_violations += checker.evaluate(r).violations.size();
+
+    ASSERT_EQ("sink sees every resource", inventory.size(), next);
+    ASSERT_EQ("sink called in input order", static_cast<std::size_t>(0), out_of_order);
+    ASSERT_EQ("same violations as evaluate()", expected_violations, violations);
+}
+
+void test_scan_propagates_exceptions() {
+    std::cout << "\n[ScanPropagatesExceptions]\n";
+    ComplianceChecker checker;
+    checker.add_rule({ "Throws", "1.0", "test", "Throws on res-5000.",
+                       [](const Resource& r) {
+                           if (r.id == "res-5000") throw std::runtime_error("boom");
+                           return true;
+                       } });
+    checker.set_concurrency(4);
+    bool threw = false;
+    try {
+        checker.scan(make_inventory(10000));
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE("rule exception rethrown by scan()", threw);
+}
+
+void test_summarize() {
+    std::cout << "\n[Summarize]\n";
+    auto checker = default_compliance_checker();
+    const auto inventory = make_inventory(20000);
+
+    const std::vector<std::string> names {
+        "RequiresOwnerTag", "SecretsNotPublic", "DatabasesMustBeRestricted", "NoUnclassifiedResources"
+    };
+
+    // Expected figures from evaluate(), one report at a time.
+    std::vector<std::uint64_t> expected(names.size(), 0);
+    std::vector<std::string>   expected_ids;
+    for (const auto& r : inventory) {
+        const auto report = checker.evaluate(r);
+        if (!report.compliant()) expected_ids.push_back(r.id);
+        for (const auto& v : report.violations)
+            for (std::size_t k = 0; k < names.size(); ++k)
+                if (v.name == names[k]) ++expected[k];
+    }
+
+    for (std::size_t threads : { 1, 4 }) {
+        checker.set_concurrency(threads);
+        const auto summary = checker.summarize(inventory);
+        const std::string suffix = " (x" + std::to_string(threads) + ")";
+
+        ASSERT_EQ("resources counted" + suffix, static_cast<std::uint64_t>(inventory.size()),
+                  summary.resources);
+        ASSERT_EQ("one entry per rule" + suffix, checker.rule_count(), summary.rules.size());
+        bool counts_match = summary.rules.size() == expected.size();
+        for (std::size_t k = 0; counts_match && k < expected.size(); ++k)
+            counts_match = summary.rules[k].rule_name == names[k] &&
+                           summary.rules[k].violations == expected[k];
+        ASSERT_TRUE("per-rule counts match evaluate()" + suffix, counts_match);
+        ASSERT_TRUE("non-compliant ids in input order" + suffix,
+                    summary.non_compliant == expected_ids);
+        ASSERT_EQ("compliant count" + suffix,
+                  static_cast<std::uint64_t>(inventory.size() - expected_ids.size()),
+                  summary.compliant_count());
+    }
+
+    const auto empty = checker.summarize(std::vector<Resource>{});
+    ASSERT_EQ("empty inventory -> zero resources", static_cast<std::uint64_t>(0), empty.resources);
+    ASSERT_EQ("empty inventory still lists rules", checker.rule_count(), empty.rules.size());
+}
+
+void test_json_compliance_summary() {
+    std::cout << "\n[JsonComplianceSummary]\n";
+    ComplianceChecker checker;
+    checker.add_rule({ "RequiresOwnerTag", "1.0", "test", "Owner tag required.",
+                       [](const Resource& r) { return r.tags.count("owner") > 0; } });
+    const std::vector<Resource> inventory {
+        { "a", "storage", "public", {{"owner", "t"}} },
+        { "b", "storage", "public", {} },
+    };
+    const auto json = to_json(checker.summarize(inventory));
+    ASSERT_TRUE("json has resources",  json.find("\"resources\": 2") != std::string::npos);
+    ASSERT_TRUE("json has compliant",  json.find("\"compliant\": 1") != std::string::npos);
+    ASSERT_TRUE("json has rule count",
+                json.find("{ \"rule\": \"RequiresOwnerTag\", \"violations\": 1 }") != std::string::npos);
+    ASSERT_TRUE("json lists non-compliant id", json.find("\"b\"") != std::string::npos);
+}
+
 // ── Main ──────────────────────────────────────────────────────────────────────
 
 int main() {
@@ -177,8 +417,16 @@ int main() {
     test_no_unclassified_resources();
     test_multiple_violations();
     test_custom_rule();
+    test_violation_records();
+    test_early_exit_modes();
+    test_rule_ordering();
     test_rule_count();
     test_json_compliance_report();
+    test_scan_matches_evaluate();
+    test_scan_sink();
+    test_scan_propagates_exceptions();
+    test_summarize();
+    test_json_compliance_summary();
 
     std::cout << "\n--- Results: "
               << passed << " passed, " << failed << " failed ---\n";
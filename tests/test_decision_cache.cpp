@@ -0,0 +1,267 @@
+#include "governance/decision_cache.hpp"
+#include "governance/policy_engine.hpp"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+static RequestContext make_request(const char* principal, const char* role,
+                                   const char* classification, const char* verb,
+                                   const char* env, bool mfa) {
+    RequestContext ctx;
+    ctx.principal    = { principal, role, "dept" };
+    ctx.resource     = { "r-" + std::string(principal), "database", classification, {} };
+    ctx.action       = { verb };
+    ctx.environment  = env;
+    ctx.mfa_verified = mfa;
+    return ctx;
+}
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_cached_results_match() {
+    std::cout << "\n[CachedResultsMatch]\n";
+    auto plain  = default_policy_engine();
+    auto cached = default_policy_engine();
+    cached.enable_cache(1024);
+    ASSERT_TRUE("default engine is cacheable", cached.cache_active());
+
+    std::size_t mismatches = 0;
+    for (int pass = 0; pass < 2; ++pass)
+    for (const char* role : { "admin", "engineer", "analyst", "guest" })
+    for (const char* cls  : { "public", "internal", "confidential", "restricted" })
+    for (const char* verb : { "read", "write", "delete" })
+    for (const char* env  : { "production", "staging", "dev" })
+    for (bool mfa : { false, true }) {
+        auto ctx      = make_request("p", role, cls, verb, env, mfa);
+        auto expected = plain.evaluate(ctx);
+        auto actual   = cached.evaluate(ctx);
+        if (actual.decision.effect      != expected.decision.effect ||
+            actual.decision.policy_name != expected.decision.policy_name ||
+            actual.decision.reason      != expected.decision.reason ||
+            actual.trace.steps.size()   != expected.trace.steps.size() ||
+            cached.decide(ctx)          != expected.decision.effect)
+            ++mismatches;
+    }
+    ASSERT_EQ("cached engine agrees with uncached engine",
+              static_cast<std::size_t>(0), mismatches);
+
+    auto stats = cached.cache_stats();
+    ASSERT_EQ("first pass misses once per cell", static_cast<std::uint64_t>(288), stats.misses);
+    ASSERT_EQ("every other lookup hits", static_cast<std::uint64_t>(288 * 3), stats.hits);
+    ASSERT_EQ("one entry per cell", static_cast<std::size_t>(288), stats.size);
+}
+
+void test_unread_attributes_share_entry() {
+    std::cout << "\n[UnreadAttributesShareEntry]\n";
+    auto engine = default_policy_engine();
+    engine.enable_cache(16);
+
+    auto a = make_request("alice", "engineer", "internal", "read", "dev", false);
+    auto b = make_request("bob",   "engineer", "internal", "read", "dev", false);
+    b.resource.type = "compute";
+
+    engine.decide(a);
+    auto result = engine.evaluate(b);
+    ASSERT_EQ("second request hits", static_cast<std::uint64_t>(1), engine.cache_stats().hits);
+    ASSERT_EQ("trace context comes from the live request",
+              std::string("bob"), result.trace.context.principal.id);
+}
+
+void test_register_policy_invalidates() {
+    std::cout << "\n[RegisterPolicyInvalidates]\n";
+    PolicyEngine engine;
+    engine.enable_cache(16);
+    auto ctx = make_request("dave", "guest", "public", "read", "dev", false);
+
+    ASSERT_EQ("empty engine denies", Effect::Deny, engine.decide(ctx));
+    ASSERT_EQ("deny is cached", Effect::Deny, engine.decide(ctx));
+
+    engine.register_policy({
+        "GuestRead", "1.0", "test", "Guests may read.",
+        [](const RequestContext& c) -> std::optional<PolicyDecision> {
+            if (c.principal.role == "guest" && c.action.verb == "read")
+                return PolicyDecision{ Effect::Allow, "GuestRead", "Guest read." };
+            return std::nullopt;
+        },
+        { Attribute::Role, Attribute::Verb }
+    });
+    ASSERT_EQ("new policy takes effect immediately", Effect::Allow, engine.decide(ctx));
+
+    auto stats = engine.cache_stats();
+    ASSERT_EQ("one invalidation recorded", static_cast<std::uint64_t>(1), stats.invalidations);
+    ASSERT_EQ("counters survive invalidation", static_cast<std::uint64_t>(1), stats.hits);
+}
+
+void test_uncacheable_policy_bypasses() {
+    std::cout << "\n[UncacheablePolicyBypasses]\n";
+    auto engine = default_policy_engine();
+    engine.enable_cache(16);
+    engine.register_policy({
+        "OwnerMayWrite", "1.0", "test", "Owners may write their resources.",
+        [](const RequestContext& c) -> std::optional<PolicyDecision> {
+            auto it = c.resource.tags.find("owner");
+            if (it != c.resource.tags.end() && it->value == c.principal.id)
+                return PolicyDecision{ Effect::Allow, "OwnerMayWrite", "Owner access." };
+            return std::nullopt;
+        },
+        { Attribute::Tags, Attribute::PrincipalId }
+    });
+    ASSERT_TRUE("tag-reading policy disables the cache", !engine.cache_active());
+
+    auto ctx = make_request("guest1", "guest", "internal", "write", "dev", false);
+    ctx.resource.tags.set("owner", "guest1");
+    ASSERT_EQ("owner allowed", Effect::Allow, engine.decide(ctx));
+    ctx.resource.tags.set("owner", "someone-else");
+    ASSERT_EQ("non-owner denied", Effect::Deny, engine.decide(ctx));
+    ASSERT_EQ("no lookups while bypassed", static_cast<std::uint64_t>(0),
+              engine.cache_stats().hits + engine.cache_stats().misses);
+
+    PolicyEngine undeclared;
+    undeclared.enable_cache(16);
+    undeclared.register_policy({
+        "Undeclared", "1.0", "test", "Reads are not declared.",
+        [](const RequestContext&) -> std::optional<PolicyDecision> { return std::nullopt; }
+    });
+    ASSERT_TRUE("undeclared reads disable the cache", !undeclared.cache_active());
+}
+
+void test_bounded_size() {
+    std::cout << "\n[BoundedSize]\n";
+    DecisionCache cache(4);
+    for (std::uint32_t i = 0; i < 10; ++i) {
+        DecisionKey key;
+        key.role = i;
+        cache.insert(key, { { Effect::Allow, "p", "r" }, {} });
+    }
+    auto stats = cache.stats();
+    ASSERT_EQ("size capped at capacity", static_cast<std::size_t>(4), stats.size);
+    ASSERT_EQ("six evictions", static_cast<std::uint64_t>(6), stats.evictions);
+
+    DecisionKey newest;
+    newest.role = 9;
+    ASSERT_TRUE("most recent entry retained", cache.lookup_effect(newest).has_value());
+}
+
+void test_sharded() {
+    std::cout << "\n[Sharded]\n";
+    DecisionCache cache(1024, 8);
+    ASSERT_EQ("eight shards", static_cast<std::size_t>(8), cache.shard_count());
+    ASSERT_EQ("capacity split evenly", static_cast<std::size_t>(1024), cache.capacity());
+
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        DecisionKey key;
+        key.role = i;
+        cache.insert(key, { { i % 2 ? Effect::Allow : Effect::Deny, "p", "r" }, {} });
+    }
+    std::size_t found = 0;
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        DecisionKey key;
+        key.role = i;
+        auto effect = cache.lookup_effect(key);
+        if (effect && *effect == (i % 2 ? Effect::Allow : Effect::Deny)) ++found;
+    }
+    ASSERT_EQ("every key found in its shard", static_cast<std::size_t>(256), found);
+
+    auto stats = cache.stats();
+    ASSERT_EQ("hits summed over shards", static_cast<std::uint64_t>(256), stats.hits);
+    ASSERT_EQ("size summed over shards", static_cast<std::size_t>(256), stats.size);
+    ASSERT_EQ("capacity summed over shards", static_cast<std::size_t>(1024), stats.capacity);
+
+    auto fresh = cache.invalidated();
+    ASSERT_EQ("invalidation keeps the shards", static_cast<std::size_t>(8), fresh->shard_count());
+    ASSERT_EQ("invalidation carries hits", static_cast<std::uint64_t>(256), fresh->stats().hits);
+    ASSERT_EQ("one invalidation recorded", static_cast<std::uint64_t>(1), fresh->stats().invalidations);
+
+    ASSERT_EQ("small caches get fewer shards", static_cast<std::size_t>(2),
+              DecisionCache(40, 64).shard_count());
+    ASSERT_EQ("shard count rounded to a power of two", static_cast<std::size_t>(4),
+              DecisionCache(1024, 6).shard_count());
+    ASSERT_TRUE("per-core sharding", DecisionCache(1 << 16, DecisionCache::kShardPerCore).shard_count() >= 1);
+}
+
+void test_sharded_engine_concurrent() {
+    std::cout << "\n[ShardedEngineConcurrent]\n";
+    const char* roles[] = { "admin", "engineer", "analyst", "guest" };
+    const char* verbs[] = { "read", "write", "delete" };
+    const char* envs[]  = { "dev", "staging", "production" };
+    std::vector<RequestContext> requests;
+    for (auto role : roles)
+        for (auto verb : verbs)
+            for (auto env : envs)
+                for (bool mfa : { false, true })
+                    requests.push_back(make_request("p", role, "restricted", verb, env, mfa));
+
+    const auto reference = default_policy_engine();
+    auto cached = default_policy_engine();
+    cached.enable_cache(256, 8);
+
+    std::vector<std::size_t> mismatches(4, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            for (std::size_t i = 0; i < 20000; ++i) {
+                const auto& ctx = requests[(i * 7 + t) % requests.size()];
+                if (cached.decide(ctx) != reference.decide(ctx)) ++mismatches[t];
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    std::size_t total = 0;
+    for (auto m : mismatches) total += m;
+    ASSERT_EQ("concurrent sharded decisions match", static_cast<std::size_t>(0), total);
+    auto stats = cached.cache_stats();
+    ASSERT_EQ("every lookup counted", static_cast<std::uint64_t>(80000), stats.hits + stats.misses);
+    ASSERT_TRUE("mostly hits", stats.hits > 79000);
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Decision Cache Tests ===\n";
+
+    test_cached_results_match();
+    test_unread_attributes_share_entry();
+    test_register_policy_invalidates();
+    test_uncacheable_policy_bypasses();
+    test_bounded_size();
+    test_sharded();
+    test_sharded_engine_concurrent();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
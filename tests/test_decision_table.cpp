@@ -0,0 +1,159 @@
+#include "governance/decision_table.hpp"
+#include "governance/policy_engine.hpp"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace governance;
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_compile_default_engine() {
+    std::cout << "\n[CompileDefaultEngine]\n";
+    auto table = DecisionTable::compile(default_policy_engine());
+
+    // Built-ins read role, classification, verb, environment and mfa, not type.
+    ASSERT_EQ("4 roles x 4 classes x 4 verbs x 3 envs x 2 mfa",
+              static_cast<std::size_t>(384), table.cell_count());
+    ASSERT_EQ("compiled table agrees with interpreted engine on every cell",
+              static_cast<std::size_t>(0), table.verify());
+}
+
+void test_agrees_with_engine() {
+    std::cout << "\n[AgreesWithEngine]\n";
+    auto engine = default_policy_engine();
+    auto table  = DecisionTable::compile(engine);
+
+    std::size_t mismatches = 0;
+    std::size_t in_domain  = 0;
+    for (const char* role : { "admin", "engineer", "analyst", "guest", "contractor" })
+    for (const char* type : { "database", "secret", "queue" })
+    for (const char* cls  : { "public", "internal", "confidential", "restricted", "" })
+    for (const char* verb : { "read", "write", "delete", "execute", "approve" })
+    for (const char* env  : { "production", "staging", "dev", "qa" })
+    for (bool mfa : { false, true }) {
+        RequestContext ctx;
+        ctx.principal    = { "p", role, "dept" };
+        ctx.resource     = { "r", type, cls, {} };
+        ctx.action       = { verb };
+        ctx.environment  = env;
+        ctx.mfa_verified = mfa;
+
+        auto expected = engine.evaluate(ctx).decision;
+        auto actual   = table.decision(ctx);
+        if (table.decide(ctx) != expected.effect ||
+            actual.policy_name != expected.policy_name ||
+            actual.reason      != expected.reason)
+            ++mismatches;
+        if (table.in_domain(ctx)) ++in_domain;
+    }
+    ASSERT_EQ("table agrees with engine, including out-of-domain fallbacks",
+              static_cast<std::size_t>(0), mismatches);
+    ASSERT_EQ("resource type is not a table dimension",
+              static_cast<std::size_t>(384 * 3), in_domain);
+}
+
+void test_out_of_domain_fallback() {
+    std::cout << "\n[OutOfDomainFallback]\n";
+    PolicyEngine engine;
+    engine.register_policy({
+        "ContractorRead", "1.0", "test", "Contractors may read.",
+        [](const RequestContext& ctx) -> std::optional<PolicyDecision> {
+            if (ctx.principal.role == "contractor" && ctx.action.verb == symbols::verb_read)
+                return PolicyDecision{ Effect::Allow, "ContractorRead", "Contractor read." };
+            return std::nullopt;
+        },
+        { Attribute::Role, Attribute::Verb }
+    });
+    auto table = DecisionTable::compile(engine);
+    ASSERT_EQ("4 roles x 4 verbs", static_cast<std::size_t>(16), table.cell_count());
+
+    RequestContext ctx;
+    ctx.principal = { "c", "contractor", "Ext" };
+    ctx.action    = { "read" };
+    ASSERT_TRUE("unknown role is out of domain", !table.in_domain(ctx));
+    ASSERT_EQ("fallback evaluates the policy", Effect::Allow, table.decide(ctx));
+
+    auto domain = DecisionTable::Domain::well_known();
+    domain.roles.push_back("contractor");
+    auto extended = DecisionTable::compile(engine, domain);
+    ASSERT_TRUE("extended domain covers the role", extended.in_domain(ctx));
+    ASSERT_EQ("extended table allows", Effect::Allow, extended.decide(ctx));
+    ASSERT_EQ("extended table verifies", static_cast<std::size_t>(0), extended.verify());
+}
+
+void test_uncacheable_engine_rejected() {
+    std::cout << "\n[UncacheableEngineRejected]\n";
+    auto engine = default_policy_engine();
+    engine.register_policy({
+        "Undeclared", "1.0", "test", "Reads are not declared.",
+        [](const RequestContext&) -> std::optional<PolicyDecision> { return std::nullopt; }
+    });
+
+    bool threw = false;
+    try {
+        DecisionTable::compile(engine);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    ASSERT_TRUE("compile throws std::invalid_argument", threw);
+}
+
+void test_cache_not_shared() {
+    std::cout << "\n[CacheNotShared]\n";
+    auto engine = default_policy_engine();
+    engine.enable_cache(4096);
+    auto table = DecisionTable::compile(engine);
+
+    const auto compiled = engine.cache_stats();
+    ASSERT_EQ("compile leaves the caller's cache empty", static_cast<std::size_t>(0), compiled.size);
+    ASSERT_EQ("compile makes no cache lookups", static_cast<std::uint64_t>(0), compiled.misses);
+
+    ASSERT_EQ("cache-enabled engine verifies", static_cast<std::size_t>(0), table.verify());
+    ASSERT_EQ("verify() reads no cached decisions", static_cast<std::uint64_t>(0), engine.cache_stats().hits);
+    ASSERT_EQ("nor does the table's engine", static_cast<std::uint64_t>(0), table.engine().cache_stats().hits);
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Decision Table Tests ===\n";
+
+    test_compile_default_engine();
+    test_agrees_with_engine();
+    test_out_of_domain_fallback();
+    test_uncacheable_engine_rejected();
+    test_cache_not_shared();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
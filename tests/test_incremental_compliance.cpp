@@ -0,0 +1,211 @@
+#include "governance/compliance.hpp"
+#include "governance/incremental_compliance.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+// The default rules plus one that reads a "region" tag, and one per field
+// that counts its calls, so tests can see exactly which rules re-ran.
+struct Counters {
+    std::uint64_t type = 0, classification = 0, owner = 0, any_tag = 0;
+};
+
+static ComplianceChecker counting_checker(Counters& calls) {
+    auto checker = default_compliance_checker();
+    checker.add_rule({ "RequiresEuRegion", "1.0", "test", "Region must be in the EU.",
+                       [](const Resource& r) {
+                           auto it = r.tags.find("region");
+                           return it != r.tags.end() && it->value.rfind("eu-", 0) == 0;
+                       },
+                       1, nullptr, { Attribute::Tags }, { "region" } });
+    checker.add_rule({ "CountType", "1.0", "test", "Counts type reads.",
+                       [&calls](const Resource&) { ++calls.type; return true; },
+                       1, nullptr, { Attribute::ResourceType }, {} });
+    checker.add_rule({ "CountClassification", "1.0", "test", "Counts classification reads.",
+                       [&calls](const Resource&) { ++calls.classification; return true; },
+                       1, nullptr, { Attribute::Classification }, {} });
+    checker.add_rule({ "CountOwner", "1.0", "test", "Counts owner reads.",
+                       [&calls](const Resource&) { ++calls.owner; return true; },
+                       1, nullptr, { Attribute::Tags }, { "owner" } });
+    checker.add_rule({ "CountAnyTag", "1.0", "test", "Counts tag reads.",
+                       [&calls](const Resource&) { ++calls.any_tag; return true; },
+                       1, nullptr, { Attribute::Tags }, {} });
+    return checker;
+}
+
+static Resource make_resource(const std::string& id) {
+    return { id, "database", "restricted", { { "owner", "team-a" }, { "region", "eu-1" } } };
+}
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_upsert_and_lookup() {
+    std::cout << "\n[Upsert and lookup]\n";
+    Counters calls;
+    IncrementalComplianceChecker incremental(counting_checker(calls));
+    const auto rules = incremental.checker().rule_count();
+
+    const auto& report = incremental.upsert(make_resource("db-1"));
+    ASSERT_TRUE("new resource evaluated in full", report.compliant());
+    ASSERT_EQ("every rule ran", static_cast<std::uint64_t>(rules), incremental.rule_evaluations());
+    ASSERT_EQ("size", static_cast<std::size_t>(1), incremental.size());
+    ASSERT_TRUE("resource tracked", incremental.resource("db-1") != nullptr);
+    ASSERT_TRUE("report tracked", incremental.report("db-1") != nullptr);
+    ASSERT_TRUE("unknown id has no report", incremental.report("db-2") == nullptr);
+
+    // Re-upserting the same resource changes nothing, so nothing re-runs.
+    incremental.upsert(make_resource("db-1"));
+    ASSERT_EQ("identical upsert runs no rules", static_cast<std::uint64_t>(rules),
+              incremental.rule_evaluations());
+
+    Resource changed = make_resource("db-1");
+    changed.tags.erase("owner");
+    const auto& updated = incremental.upsert(changed);
+    ASSERT_EQ("upsert re-runs owner rules", static_cast<std::uint64_t>(rules + 3),
+              incremental.rule_evaluations());
+    ASSERT_EQ("missing owner reported", static_cast<std::size_t>(1), updated.violations.size());
+    ASSERT_TRUE("violation is the owner rule", updated.violations[0].name == "RequiresOwnerTag");
+
+    ASSERT_TRUE("erase tracked", incremental.erase("db-1"));
+    ASSERT_TRUE("erase untracked", !incremental.erase("db-1"));
+    ASSERT_EQ("empty after erase", static_cast<std::size_t>(0), incremental.size());
+}
+
+void test_affected_rules_only() {
+    std::cout << "\n[Affected rules only]\n";
+    Counters calls;
+    IncrementalComplianceChecker incremental(counting_checker(calls));
+    incremental.upsert(make_resource("db-1"));
+    calls = Counters{};
+    const auto base = incremental.rule_evaluations();
+
+    ResourceDelta region { "db-1", std::nullopt, std::nullopt, { { "region", std::string("us-1") } } };
+    const auto& report = incremental.apply(region);
+    ASSERT_EQ("region change runs region and any-tag rules", base + 2, incremental.rule_evaluations());
+    ASSERT_EQ("owner rule skipped", static_cast<std::uint64_t>(0), calls.owner);
+    ASSERT_EQ("any-tag rule ran", static_cast<std::uint64_t>(1), calls.any_tag);
+    ASSERT_EQ("type rules skipped", static_cast<std::uint64_t>(0), calls.type);
+    ASSERT_TRUE("region violation reported",
+                report.violations.size() == 1 && report.violations[0].name == "RequiresEuRegion");
+
+    ResourceDelta type { "db-1", Symbol("secret"), std::nullopt, {} };
+    incremental.apply(type);
+    ASSERT_EQ("type rule ran once", static_cast<std::uint64_t>(1), calls.type);
+    ASSERT_EQ("classification-only rule skipped", static_cast<std::uint64_t>(0), calls.classification);
+
+    // Setting fields to their current values is not a change.
+    const auto before = incremental.rule_evaluations();
+    ResourceDelta same { "db-1", Symbol("secret"), Symbol("restricted"), { { "owner", std::string("team-a") } } };
+    incremental.apply(same);
+    ASSERT_EQ("no-op delta runs no rules", before, incremental.rule_evaluations());
+
+    // Removing an absent tag is not a change either.
+    ResourceDelta absent { "db-1", std::nullopt, std::nullopt, { { "cost-center", std::nullopt } } };
+    incremental.apply(absent);
+    ASSERT_EQ("removing absent tag runs no rules", before, incremental.rule_evaluations());
+
+    // A rule reached through two changed fields runs once.
+    ResourceDelta both { "db-1", std::nullopt, std::nullopt,
+                         { { "owner", std::nullopt }, { "region", std::string("eu-2") } } };
+    calls = Counters{};
+    const auto& cleared = incremental.apply(both);
+    ASSERT_EQ("any-tag rule deduplicated", static_cast<std::uint64_t>(1), calls.any_tag);
+    ASSERT_TRUE("region violation cleared, owner violation added",
+                cleared.violations.size() == 1 && cleared.violations[0].name == "RequiresOwnerTag");
+}
+
+void test_unknown_resource() {
+    std::cout << "\n[Unknown resource]\n";
+    IncrementalComplianceChecker incremental(default_compliance_checker());
+    bool threw = false;
+    try {
+        incremental.apply({ "missing", Symbol("secret"), std::nullopt, {} });
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    ASSERT_TRUE("apply to untracked id throws", threw);
+}
+
+void test_matches_full_evaluation() {
+    std::cout << "\n[Matches full evaluation]\n";
+    Counters calls;
+    IncrementalComplianceChecker incremental(counting_checker(calls));
+    const ComplianceChecker& full = incremental.checker();
+
+    const char* types[]           = { "database", "storage", "secret", "compute" };
+    const char* classifications[] = { "public", "restricted", "confidential", "" };
+    const char* keys[]            = { "owner", "region", "env" };
+    const char* values[]          = { "team-a", "eu-1", "us-1", "" };
+
+    std::mt19937 rng(7);
+    for (int i = 0; i < 16; ++i) incremental.upsert(make_resource("res-" + std::to_string(i)));
+
+    bool all_match = true;
+    for (int event = 0; event < 5000; ++event) {
+        ResourceDelta delta;
+        delta.id = "res-" + std::to_string(rng() % 16);
+        if (rng() % 3 == 0) delta.type = Symbol(types[rng() % 4]);
+        if (rng() % 3 == 0) delta.classification = Symbol(classifications[rng() % 4]);
+        for (unsigned n = rng() % 3; n > 0; --n) {
+            const char* key = keys[rng() % 3];
+            if (rng() % 4 == 0) {
+                delta.tags.emplace_back(key, std::nullopt);
+            } else {
+                delta.tags.emplace_back(key, std::string(values[rng() % 4]));
+            }
+        }
+        const auto& report = incremental.apply(delta);
+        if (report.violations != full.evaluate(*incremental.resource(delta.id)).violations) all_match = false;
+    }
+    ASSERT_TRUE("reports equal evaluate() after 5000 random deltas", all_match);
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Incremental Compliance Tests ===\n";
+
+    test_upsert_and_lookup();
+    test_affected_rules_only();
+    test_unknown_resource();
+    test_matches_full_evaluation();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,308 @@
+#include "governance/compliance.hpp"
+#include "governance/inventory_snapshot.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace governance;
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Fixtures ──────────────────────────────────────────────────────────────────
+
+static std::vector<Resource> inventory(std::size_t n) {
+    const char* types[]           = { "database", "bucket", "cluster" };
+    const char* classifications[] = { "public", "internal", "confidential", "restricted" };
+    std::vector<Resource> out;
+    for (std::size_t i = 0; i < n; ++i) {
+        Resource r;
+        r.id             = "res-" + std::to_string(i);
+        r.type           = Symbol(types[i % 3]);
+        r.classification = Symbol(classifications[i % 4]);
+        if (i % 5 != 0) r.tags.set(Symbol("owner"), "team-" + std::to_string(i % 7));
+        if (i % 2 == 0) r.tags.set(Symbol("env"), i % 4 == 0 ? "prod" : "dev");
+        if (i % 9 == 0) {
+            for (int t = 0; t < 6; ++t) r.tags.set(Symbol("label-" + std::to_string(t)), "x");
+        }
+        out.push_back(std::move(r));
+    }
+    return out;
+}
+
+// A written snapshot in 8-byte aligned memory, as view() requires.
+static std::vector<std::uint64_t> image(const std::vector<Resource>& resources, std::size_t& size) {
+    SnapshotWriter writer;
+    for (const auto& r : resources) writer.add(r);
+    std::ostringstream out;
+    writer.write(out);
+    const std::string bytes = out.str();
+    size = bytes.size();
+    std::vector<std::uint64_t> buffer((size + 7) / 8);
+    std::memcpy(buffer.data(), bytes.data(), size);
+    return buffer;
+}
+
+static bool same(const Resource& a, const Resource& b) {
+    return a.id == b.id && a.type == b.type && a.classification == b.classification && a.tags == b.tags;
+}
+
+static bool same(const ComplianceSummary& a, const ComplianceSummary& b) {
+    if (a.resources != b.resources || a.non_compliant != b.non_compliant || a.rules.size() != b.rules.size())
+        return false;
+    for (std::size_t r = 0; r < a.rules.size(); ++r) {
+        if (a.rules[r].violations != b.rules[r].violations) return false;
+    }
+    return true;
+}
+
+static bool same(const ComplianceReport& a, const ComplianceReport& b) {
+    if (a.resource_id != b.resource_id || a.violations.size() != b.violations.size()) return false;
+    for (std::size_t v = 0; v < a.violations.size(); ++v) {
+        if (a.violations[v].str() != b.violations[v].str()) return false;
+    }
+    return true;
+}
+
+template <typename Fn>
+static bool throws_invalid(Fn&& fn) {
+    try {
+        fn();
+    } catch (const std::invalid_argument&) {
+        return true;
+    }
+    return false;
+}
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_round_trip() {
+    std::cout << "\n[Round trip]\n";
+    const auto resources = inventory(200);
+    std::size_t size = 0;
+    const auto buffer = image(resources, size);
+    const auto snapshot = InventorySnapshot::view(buffer.data(), size);
+
+    ASSERT_EQ("size", resources.size(), snapshot.size());
+    ASSERT_EQ("file size", size, snapshot.file_size());
+    ASSERT_EQ("vocabulary entry 0 is empty", Symbol(), snapshot.vocabulary()[0]);
+    ASSERT_EQ("id", std::string("res-42"), std::string(snapshot.id(42)));
+
+    bool all_same = true;
+    Resource scratch;
+    for (std::size_t i = 0; i < resources.size(); ++i) {
+        snapshot.read(i, scratch);
+        all_same = all_same && same(resources[i], scratch);
+    }
+    ASSERT_TRUE("read() into a reused Resource equals the originals", all_same);
+    ASSERT_TRUE("read() spilled tags", same(resources[18], snapshot.read(18)));
+
+    bool valid = true;
+    try {
+        snapshot.validate();
+    } catch (const std::exception&) {
+        valid = false;
+    }
+    ASSERT_TRUE("validate() accepts a written snapshot", valid);
+
+    std::size_t empty_size = 0;
+    const auto empty = image({}, empty_size);
+    ASSERT_EQ("empty snapshot", static_cast<std::size_t>(0), InventorySnapshot::view(empty.data(), empty_size).size());
+}
+
+void test_compliance() {
+    std::cout << "\n[Compliance over a snapshot]\n";
+    const auto resources = inventory(3000);
+    std::size_t size = 0;
+    const auto buffer = image(resources, size);
+    const auto snapshot = InventorySnapshot::view(buffer.data(), size);
+    auto checker = default_compliance_checker();
+
+    const auto expected = checker.summarize(resources);
+    ASSERT_TRUE("some resources fail", !expected.non_compliant.empty());
+    ASSERT_TRUE("summarize() equals the row summary", same(expected, checker.summarize(snapshot)));
+
+    bool in_order = true, all_match = true;
+    std::size_t next = 0;
+    checker.scan(snapshot, [&](std::size_t i, ComplianceReport&& report) {
+        in_order  = in_order && i == next++;
+        all_match = all_match && same(report, checker.evaluate(resources[i]));
+    });
+    ASSERT_EQ("scan() visits every resource", resources.size(), next);
+    ASSERT_TRUE("scan() reports in input order", in_order);
+    ASSERT_TRUE("scan() reports equal evaluate()", all_match);
+
+    checker.set_concurrency(4);
+    ASSERT_TRUE("summarize() with 4 threads", same(expected, checker.summarize(snapshot)));
+    next = 0;
+    checker.scan(snapshot, [&](std::size_t i, ComplianceReport&&) { in_order = in_order && i == next++; });
+    ASSERT_TRUE("scan() with 4 threads stays in order", in_order && next == resources.size());
+}
+
+void test_corruption() {
+    std::cout << "\n[Corruption]\n";
+    const auto resources = inventory(50);
+    std::size_t size = 0;
+    const auto good = image(resources, size);
+
+    auto bad = good;
+    bad[0] ^= 1;
+    ASSERT_TRUE("bad magic", throws_invalid([&] { InventorySnapshot::view(bad.data(), size); }));
+    ASSERT_TRUE("truncated", throws_invalid([&] { InventorySnapshot::view(good.data(), size - 8); }));
+    ASSERT_TRUE("shorter than a header", throws_invalid([&] { InventorySnapshot::view(good.data(), 16); }));
+
+    std::vector<std::uint64_t> shifted(good.size() + 1);
+    std::memcpy(reinterpret_cast<char*>(shifted.data()) + 4, good.data(), size);
+    ASSERT_TRUE("misaligned", throws_invalid([&] {
+        InventorySnapshot::view(reinterpret_cast<const char*>(shifted.data()) + 4, size);
+    }));
+
+    bad = good;
+    auto* header = reinterpret_cast<snapshot::Header*>(bad.data());
+    header->resource_count = ~std::uint64_t { 0 } / sizeof(snapshot::Record);
+    ASSERT_TRUE("record count past the end", throws_invalid([&] { InventorySnapshot::view(bad.data(), size); }));
+
+    // A record whose id runs past the strings section: open() does not look
+    // at records, read() and validate() must.
+    bad = good;
+    header = reinterpret_cast<snapshot::Header*>(bad.data());
+    auto* records = reinterpret_cast<snapshot::Record*>(reinterpret_cast<char*>(bad.data()) + header->records_offset);
+    records[7].id.size = 0xffffffffu;
+    const auto corrupt = InventorySnapshot::view(bad.data(), size);
+    ASSERT_EQ("opens lazily", resources.size(), corrupt.size());
+    ASSERT_TRUE("other records still read", same(resources[6], corrupt.read(6)));
+    ASSERT_TRUE("read() of the bad record throws", throws_invalid([&] { corrupt.read(7); }));
+    ASSERT_TRUE("validate() throws", throws_invalid([&] { corrupt.validate(); }));
+
+    bad = good;
+    header = reinterpret_cast<snapshot::Header*>(bad.data());
+    records = reinterpret_cast<snapshot::Record*>(reinterpret_cast<char*>(bad.data()) + header->records_offset);
+    records[3].type = 1000;
+    ASSERT_TRUE("vocabulary index out of range", throws_invalid([&] {
+        InventorySnapshot::view(bad.data(), size).read(3);
+    }));
+
+    // Duplicate tag keys only validate() catches; read() keeps the last.
+    bad = good;
+    header = reinterpret_cast<snapshot::Header*>(bad.data());
+    records = reinterpret_cast<snapshot::Record*>(reinterpret_cast<char*>(bad.data()) + header->records_offset);
+    auto* tags = reinterpret_cast<snapshot::Tag*>(reinterpret_cast<char*>(bad.data()) + header->tags_offset);
+    tags[records[2].tags_begin + 1].key = tags[records[2].tags_begin].key;
+    ASSERT_TRUE("duplicate tag keys fail validate()", throws_invalid([&] {
+        InventorySnapshot::view(bad.data(), size).validate();
+    }));
+}
+
+void test_file() {
+    std::cout << "\n[File]\n";
+    const auto resources = inventory(100);
+    const std::string path = "test_inventory_snapshot.tmp";
+    {
+        SnapshotWriter writer;
+        for (const auto& r : resources) writer.add(r);
+        std::ofstream out(path, std::ios::binary);
+        writer.write(out);
+    }
+
+    auto snapshot = InventorySnapshot::open(path);
+    ASSERT_EQ("open() size", resources.size(), snapshot.size());
+    ASSERT_TRUE("open() read", same(resources[99], snapshot.read(99)));
+
+    auto moved = std::move(snapshot);
+    ASSERT_TRUE("moved snapshot reads", same(resources[0], moved.read(0)));
+    ASSERT_EQ("moved-from is empty", static_cast<std::size_t>(0), snapshot.size());
+    std::remove(path.c_str());
+
+    bool threw = false;
+    try {
+        InventorySnapshot::open("no-such-snapshot.tmp");
+    } catch (const std::system_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE("open() of a missing file throws system_error", threw);
+}
+
+void test_vocabulary_limit() {
+    std::cout << "\n[VocabularyLimit]\n";
+    // A hand-built file whose vocabulary holds one distinct word more than
+    // the limit, each of which opening would otherwise intern.
+    const std::uint32_t count = snapshot::kMaxVocabulary + 1;
+    std::string strings;
+    std::vector<snapshot::String> words { { 0, 0 } };
+    char word[16];
+    for (std::uint32_t i = 1; i < count; ++i) {
+        const int n = std::snprintf(word, sizeof(word), "vocab-%06u", static_cast<unsigned>(i));
+        words.push_back({ static_cast<std::uint32_t>(strings.size()), static_cast<std::uint32_t>(n) });
+        strings.append(word, static_cast<std::size_t>(n));
+    }
+    snapshot::Header header {};
+    header.magic             = snapshot::kMagic;
+    header.version           = snapshot::kVersion;
+    header.vocabulary_count  = count;
+    header.vocabulary_offset = sizeof(header);
+    header.records_offset    = header.vocabulary_offset + count * sizeof(snapshot::String);
+    header.tags_offset       = header.records_offset;
+    header.strings_offset    = header.records_offset;
+    header.strings_size      = strings.size();
+    header.file_size         = (header.strings_offset + strings.size() + 7) / 8 * 8;
+
+    const std::string path = "test_inventory_snapshot_vocabulary.tmp";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(words.data()), static_cast<std::streamsize>(count * sizeof(snapshot::String)));
+        out << strings << std::string(header.file_size - header.strings_offset - strings.size(), '\0');
+    }
+
+    const std::size_t symbols = Symbol::table_size();
+    ASSERT_TRUE("oversized vocabulary rejected", throws_invalid([&] { InventorySnapshot::open(path); }));
+    ASSERT_EQ("nothing interned", symbols, Symbol::table_size());
+    std::remove(path.c_str());
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Inventory Snapshot Tests ===\n";
+
+    test_round_trip();
+    test_compliance();
+    test_corruption();
+    test_file();
+    test_vocabulary_limit();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
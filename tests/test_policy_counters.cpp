@@ -0,0 +1,184 @@
+#include "governance/policy_engine.hpp"
+#include "governance/json.hpp"
+#include "governance/policy_counters.hpp"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+static Policy policy(const std::string& name, std::optional<Effect> effect,
+                     std::string deny_verb = "") {
+    return {
+        name, "1.0", "test", "",
+        [name, effect, deny_verb](const RequestContext& ctx) -> std::optional<PolicyDecision> {
+            if (!deny_verb.empty()) {
+                if (ctx.action.verb.str() != deny_verb) return std::nullopt;
+                return PolicyDecision{ Effect::Deny, name, "denied" };
+            }
+            if (!effect) return std::nullopt;
+            return PolicyDecision{ *effect, name, "decided" };
+        },
+    };
+}
+
+// Abstainer, Allower, DeleteDenier, Trailing: a delete stops at DeleteDenier.
+static PolicyEngine make_engine() {
+    PolicyEngine engine;
+    engine.register_policy(policy("Abstainer", std::nullopt));
+    engine.register_policy(policy("Allower", Effect::Allow));
+    engine.register_policy(policy("DeleteDenier", std::nullopt, "delete"));
+    engine.register_policy(policy("Trailing", Effect::Allow));
+    engine.enable_counters();
+    return engine;
+}
+
+static RequestContext request(const std::string& verb, const std::string& role = "engineer") {
+    RequestContext ctx;
+    ctx.principal   = { "bob", role, "Backend" };
+    ctx.resource    = { "r", "storage", "public", {} };
+    ctx.action      = { verb };
+    ctx.environment = "dev";
+    return ctx;
+}
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_disabled_by_default() {
+    std::cout << "\n[DisabledByDefault]\n";
+    auto engine = default_policy_engine();
+    engine.decide(request("read"));
+    ASSERT_TRUE("counters off", !engine.counters_enabled());
+    ASSERT_TRUE("empty snapshot", engine.counter_snapshot().policies.empty());
+    ASSERT_EQ("no evaluations", std::uint64_t(0), engine.counter_snapshot().evaluations);
+}
+
+void test_outcomes_counted() {
+    std::cout << "\n[OutcomesCounted]\n";
+    auto engine = make_engine();
+    engine.evaluate(request("read"));
+    engine.decide(request("read"));
+    TraceArena arena;
+    engine.evaluate(request("delete"), arena);
+
+    const auto snap = engine.counter_snapshot();
+    ASSERT_EQ("three evaluations", std::uint64_t(3), snap.evaluations);
+    ASSERT_EQ("one entry per policy", std::size_t(4), snap.policies.size());
+    ASSERT_EQ("names in registration order", std::string("DeleteDenier"), snap.policies[2].policy_name);
+    ASSERT_EQ("Abstainer abstained every time", std::uint64_t(3), snap.policies[0].abstain);
+    ASSERT_EQ("Allower allowed every time", std::uint64_t(3), snap.policies[1].allow);
+    ASSERT_EQ("DeleteDenier denied once", std::uint64_t(1), snap.policies[2].deny);
+    ASSERT_EQ("DeleteDenier abstained twice", std::uint64_t(2), snap.policies[2].abstain);
+    ASSERT_EQ("Trailing not reached after the Deny", std::uint64_t(2), snap.policies[3].total());
+}
+
+void test_preconditions_not_counted() {
+    std::cout << "\n[PreconditionsNotCounted]\n";
+    PolicyEngine engine;
+    auto admins = policy("AdminsOnly", Effect::Allow);
+    admins.applies_to.roles = { "admin" };
+    engine.register_policy(admins);
+    engine.enable_counters();
+
+    engine.decide(request("read", "guest"));
+    engine.evaluate(request("read", "guest"));
+    engine.decide(request("read", "admin"));
+    const auto snap = engine.counter_snapshot();
+    ASSERT_EQ("every request evaluated", std::uint64_t(3), snap.evaluations);
+    ASSERT_EQ("invoked only for the admin", std::uint64_t(1), snap.policies[0].total());
+}
+
+void test_threads_aggregated() {
+    std::cout << "\n[ThreadsAggregated]\n";
+    const auto engine = make_engine();
+    constexpr int kThreads = 4, kPerThread = 10000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&engine] {
+            for (int i = 0; i < kPerThread; ++i) engine.decide(request(i % 4 == 0 ? "delete" : "read"));
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    const auto snap = engine.counter_snapshot();
+    ASSERT_EQ("counts of exited threads kept", std::uint64_t(kThreads * kPerThread), snap.evaluations);
+    ASSERT_EQ("denies summed across threads", std::uint64_t(kThreads * kPerThread / 4), snap.policies[2].deny);
+    ASSERT_EQ("allows summed across threads", std::uint64_t(kThreads * kPerThread * 3 / 4), snap.policies[3].allow);
+}
+
+void test_register_restarts() {
+    std::cout << "\n[RegisterRestarts]\n";
+    auto engine = make_engine();
+    engine.decide(request("read"));
+    auto copy = engine;
+    copy.decide(request("read"));
+    ASSERT_EQ("copies share counters", std::uint64_t(2), engine.counter_snapshot().evaluations);
+
+    engine.register_policy(policy("Late", Effect::Allow));
+    ASSERT_EQ("registering starts new counters", std::uint64_t(0), engine.counter_snapshot().evaluations);
+    ASSERT_EQ("new policy included", std::size_t(5), engine.counter_snapshot().policies.size());
+    ASSERT_EQ("the copy keeps its counters", std::uint64_t(2), copy.counter_snapshot().evaluations);
+
+    engine.disable_counters();
+    engine.decide(request("read"));
+    ASSERT_TRUE("disabled", engine.counter_snapshot().policies.empty());
+}
+
+void test_counters_json() {
+    std::cout << "\n[CountersJson]\n";
+    auto engine = make_engine();
+    engine.decide(request("delete"));
+    const auto json = to_json(engine.counter_snapshot());
+    ASSERT_TRUE("has evaluations", json.find("\"evaluations\": 1") != std::string::npos);
+    ASSERT_TRUE("has the denying policy",
+                json.find("{ \"policy\": \"DeleteDenier\", \"allow\": 0, \"deny\": 1, "
+                          "\"abstain\": 0, \"total\": 1 }") != std::string::npos);
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Policy Counter Tests ===\n";
+
+    test_disabled_by_default();
+    test_outcomes_counted();
+    test_preconditions_not_counted();
+    test_threads_aggregated();
+    test_register_restarts();
+    test_counters_json();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
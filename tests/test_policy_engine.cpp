@@ -3,7 +3,9 @@
 
 #include <cassert>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 using namespace governance;
 
@@ -310,6 +312,188 @@ void test_json_policy_decision() {
     ASSERT_TRUE("json contains reason",      json.find("\"Test reason.\"") != std::string::npos);
 }
 
+void test_decide_matches_evaluate() {
+    std::cout << "\n[DecideMatchesEvaluate]\n";
+    auto engine = make_default_engine();
+
+    std::size_t mismatches = 0;
+    std::size_t cells      = 0;
+    for (const char* role : { "admin", "engineer", "analyst", "guest" })
+    for (const char* cls  : { "public", "internal", "confidential", "restricted" })
+    for (const char* verb : { "read", "write", "delete", "execute" })
+    for (const char* env  : { "production", "staging", "dev" })
+    for (bool mfa : { false, true }) {
+        RequestContext ctx;
+        ctx.principal    = { "p", role, "dept" };
+        ctx.resource     = make_resource("r", "database", cls, {{"owner", "t"}});
+        ctx.action       = { verb };
+        ctx.environment  = env;
+        ctx.mfa_verified = mfa;
+        if (engine.decide(ctx) != engine.evaluate(ctx).decision.effect) ++mismatches;
+        ++cells;
+    }
+    ASSERT_EQ("decide() agrees with evaluate() on every cell",
+              static_cast<std::size_t>(0), mismatches);
+    ASSERT_EQ("grid covers 384 cells", static_cast<std::size_t>(384), cells);
+
+    PolicyEngine empty;
+    RequestContext ctx;
+    ASSERT_EQ("empty engine decide() -> Deny", Effect::Deny, empty.decide(ctx));
+}
+
+void test_batch_evaluation() {
+    std::cout << "\n[BatchEvaluation]\n";
+    auto engine = make_default_engine();
+    engine.set_concurrency(4);
+    ASSERT_EQ("concurrency set to 4", static_cast<std::size_t>(4), engine.concurrency());
+
+    const char* roles[] = { "admin", "engineer", "analyst", "guest" };
+    const char* verbs[] = { "read", "write", "delete" };
+    const char* envs[]  = { "production", "staging", "dev" };
+
+    std::vector<RequestContext> requests(5000);
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        auto& ctx        = requests[i];
+        ctx.principal    = { "p" + std::to_string(i), roles[i % 4], "dept" };
+        ctx.resource     = make_resource("r", "database", (i % 5 == 0) ? "restricted" : "internal");
+        ctx.action       = { verbs[i % 3] };
+        ctx.environment  = envs[(i / 3) % 3];
+        ctx.mfa_verified = (i % 7) == 0;
+    }
+
+    auto results = engine.evaluate_batch(requests);
+    auto effects = engine.decide_batch(requests);
+    ASSERT_EQ("one result per request", requests.size(), results.size());
+    ASSERT_EQ("one effect per request", requests.size(), effects.size());
+
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        auto expected = engine.evaluate(requests[i]);
+        if (results[i].decision.effect      != expected.decision.effect ||
+            results[i].decision.policy_name != expected.decision.policy_name ||
+            results[i].trace.context.principal.id != requests[i].principal.id ||
+            effects[i] != expected.decision.effect)
+            ++mismatches;
+    }
+    ASSERT_EQ("batch results match sequential evaluation",
+              static_cast<std::size_t>(0), mismatches);
+
+    engine.set_concurrency(1);
+    ASSERT_EQ("concurrency reset to 1", static_cast<std::size_t>(1), engine.concurrency());
+    ASSERT_TRUE("empty batch is a no-op", engine.decide_batch({}).empty());
+}
+
+void test_applicability_index() {
+    std::cout << "\n[ApplicabilityIndex]\n";
+    auto calls = std::make_shared<int>(0);
+
+    Policy analysts_only {
+        "AnalystsOnly", "1.0", "test", "Denies every analyst request.",
+        [calls](const RequestContext&) -> std::optional<PolicyDecision> {
+            ++*calls;
+            return PolicyDecision{ Effect::Deny, "AnalystsOnly", "Analyst denied." };
+        },
+        { Attribute::Role }
+    };
+    analysts_only.applies_to.roles = { "analyst" };
+
+    PolicyEngine engine;
+    engine.register_policy(analysts_only);
+    engine.register_policy({
+        "AllowAll", "1.0", "test", "Allows everything.",
+        [](const RequestContext&) -> std::optional<PolicyDecision> {
+            return PolicyDecision{ Effect::Allow, "AllowAll", "Allowed." };
+        },
+        {}
+    });
+
+    RequestContext ctx;
+    ctx.principal   = { "dave", "guest", "Consulting" };
+    ctx.resource    = make_resource("r", "storage", "public");
+    ctx.action      = { "read" };
+    ctx.environment = "dev";
+
+    auto result = engine.evaluate(ctx);
+    ASSERT_EQ("guest -> Allow", Effect::Allow, result.decision.effect);
+    ASSERT_EQ("role-restricted policy not invoked for guest", 0, *calls);
+    ASSERT_EQ("skipped policy still traced", static_cast<std::size_t>(2), result.trace.steps.size());
+    ASSERT_EQ("skipped policy traced as Abstain", StepOutcome::Abstain, result.trace.steps[0].outcome);
+    ASSERT_EQ("decide() skips it too", Effect::Allow, engine.decide(ctx));
+    ASSERT_EQ("still not invoked", 0, *calls);
+
+    ctx.principal.role = "analyst";
+    ASSERT_EQ("analyst -> Deny", Effect::Deny, engine.decide(ctx));
+    ASSERT_EQ("invoked for analyst", 1, *calls);
+
+    // Non-role preconditions are checked before the call as well.
+    Policy prod_only = analysts_only;
+    prod_only.applies_to.roles.clear();
+    prod_only.applies_to.environments = { "production" };
+    PolicyEngine env_engine;
+    env_engine.register_policy(prod_only);
+    ASSERT_EQ("dev request -> default Deny without invoking",
+              std::string("default"), env_engine.evaluate(ctx).decision.policy_name);
+    ASSERT_EQ("environment precondition skipped the call", 1, *calls);
+}
+
+void test_indexed_traces_unchanged() {
+    std::cout << "\n[IndexedTracesUnchanged]\n";
+    auto indexed = make_default_engine();
+
+    PolicyEngine unindexed;
+    for (auto policy : { admin_full_access(), mfa_required_for_restricted(),
+                         production_immutability(), analyst_read_only(), engineer_access() }) {
+        policy.applies_to = {};
+        unindexed.register_policy(policy);
+    }
+
+    std::size_t mismatches = 0;
+    for (const char* role : { "admin", "engineer", "analyst", "guest", "auditor" })
+    for (const char* cls  : { "public", "confidential", "restricted" })
+    for (const char* verb : { "read", "write", "delete" })
+    for (const char* env  : { "production", "staging", "dev" })
+    for (bool mfa : { false, true }) {
+        RequestContext ctx;
+        ctx.principal    = { "p", role, "dept" };
+        ctx.resource     = make_resource("r", "database", cls);
+        ctx.action       = { verb };
+        ctx.environment  = env;
+        ctx.mfa_verified = mfa;
+        if (to_json(indexed.evaluate(ctx)) != to_json(unindexed.evaluate(ctx)) ||
+            indexed.decide(ctx) != unindexed.decide(ctx))
+            ++mismatches;
+    }
+    ASSERT_EQ("indexed engine output identical to unindexed engine",
+              static_cast<std::size_t>(0), mismatches);
+}
+
+void test_evaluate_view_preferred() {
+    std::cout << "\n[EvaluateViewPreferred]\n";
+    auto owning_calls = std::make_shared<int>(0);
+
+    Policy policy {
+        "Both", "1.0", "test", "Has both forms.",
+        [owning_calls](const RequestContext&) -> std::optional<PolicyDecision> {
+            ++*owning_calls;
+            return PolicyDecision{ Effect::Allow, "Both", "Allowed." };
+        },
+        {}
+    };
+    policy.evaluate_view = [](const RequestContext&) -> std::optional<DecisionView> {
+        return DecisionView{ Effect::Allow, "Both", "Allowed." };
+    };
+    PolicyEngine engine;
+    engine.register_policy(policy);
+
+    RequestContext ctx;
+    ctx.principal = { "p", "guest", "dept" };
+    auto result = engine.evaluate(ctx);
+    ASSERT_EQ("view form decides", Effect::Allow, result.decision.effect);
+    ASSERT_EQ("owning copy of the view's reason", std::string("Allowed."), result.decision.reason);
+    ASSERT_EQ("decide agrees", Effect::Allow, engine.decide(ctx));
+    ASSERT_EQ("owning form never called", 0, *owning_calls);
+}
+
 // ── Main ──────────────────────────────────────────────────────────────────────
 
 int main() {
@@ -326,6 +510,11 @@ int main() {
     test_evaluation_trace();
     test_trace_context_preserved();
     test_json_policy_decision();
+    test_decide_matches_evaluate();
+    test_batch_evaluation();
+    test_applicability_index();
+    test_indexed_traces_unchanged();
+    test_evaluate_view_preferred();
 
     std::cout << "\n--- Results: "
               << passed << " passed, " << failed << " failed ---\n";
@@ -0,0 +1,203 @@
+#include "governance/policy_engine.hpp"
+#include "governance/json.hpp"
+#include "governance/latency_histogram.hpp"
+#include "governance/trace_arena.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+// Busy-waits so the duration does not depend on the scheduler's sleep granularity.
+static void spin_for(std::chrono::microseconds d) {
+    const auto until = std::chrono::steady_clock::now() + d;
+    while (std::chrono::steady_clock::now() < until) {}
+}
+
+// Fast abstainer, then a policy that takes ~200 us and allows.
+static PolicyEngine make_engine() {
+    PolicyEngine engine;
+    engine.register_policy({
+        "Fast", "1.0", "test", "",
+        [](const RequestContext&) -> std::optional<PolicyDecision> { return std::nullopt; },
+    });
+    engine.register_policy({
+        "Slow", "1.0", "test", "",
+        [](const RequestContext&) -> std::optional<PolicyDecision> {
+            spin_for(std::chrono::microseconds(200));
+            return PolicyDecision{ Effect::Allow, "Slow", "eventually" };
+        },
+    });
+    return engine;
+}
+
+static RequestContext request() {
+    RequestContext ctx;
+    ctx.principal   = { "bob", "engineer", "Backend" };
+    ctx.resource    = { "r", "storage", "public", {} };
+    ctx.action      = { "read" };
+    ctx.environment = "dev";
+    return ctx;
+}
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_histogram_buckets() {
+    std::cout << "\n[HistogramBuckets]\n";
+    bool contained = true, precise = true, monotonic = true;
+    std::size_t previous = 0;
+    for (std::uint64_t v = 0; v < (std::uint64_t(1) << 39); v = v < 64 ? v + 1 : v + v / 7 + 1) {
+        const auto b = LatencyHistogram::bucket_of(v);
+        if (b >= LatencyHistogram::kBuckets || LatencyHistogram::bucket_upper(b) < v) contained = false;
+        if (b > 0 && LatencyHistogram::bucket_upper(b - 1) >= v) contained = false;
+        if (static_cast<double>(LatencyHistogram::bucket_upper(b) - v) > static_cast<double>(v) / 8.0) precise = false;
+        if (b < previous) monotonic = false;
+        previous = b;
+    }
+    ASSERT_TRUE("every value lands in the bucket whose range holds it", contained);
+    ASSERT_TRUE("bucket bounds within 12.5%", precise);
+    ASSERT_TRUE("buckets ordered by value", monotonic);
+    ASSERT_EQ("huge values clamp to the last bucket", LatencyHistogram::kBuckets - 1,
+              LatencyHistogram::bucket_of(~std::uint64_t(0)));
+}
+
+void test_histogram_percentiles() {
+    std::cout << "\n[HistogramPercentiles]\n";
+    LatencyHistogram h;
+    ASSERT_EQ("empty percentile", std::uint64_t(0), h.percentile(0.99));
+    for (std::uint64_t v = 1; v <= 1000; ++v) h.record(v * 1000);   // 1 us .. 1 ms
+
+    auto near = [](std::uint64_t got, std::uint64_t want) {
+        return got >= want && static_cast<double>(got) <= static_cast<double>(want) * 1.125;
+    };
+    ASSERT_EQ("count", std::uint64_t(1000), h.count());
+    ASSERT_TRUE("p50 ~ 500 us", near(h.percentile(0.50), 500000));
+    ASSERT_TRUE("p99 ~ 990 us", near(h.percentile(0.99), 990000));
+    ASSERT_EQ("p100 is the exact max", std::uint64_t(1000000), h.percentile(1.0));
+    ASSERT_TRUE("mean", h.mean() > 500000.0 && h.mean() < 501000.0);
+
+    LatencyHistogram other;
+    other.record(5000000);
+    h.merge(other);
+    ASSERT_EQ("merge adds counts", std::uint64_t(1001), h.count());
+    ASSERT_EQ("merge keeps the max", std::uint64_t(5000000), h.max());
+}
+
+void test_disabled() {
+    std::cout << "\n[Disabled]\n";
+    auto engine = make_engine();
+    auto result = engine.evaluate(request());
+    ASSERT_TRUE("profiling off by default", !engine.profiling_enabled());
+    ASSERT_TRUE("empty profile", engine.profile_snapshot().policies.empty());
+    ASSERT_EQ("no step durations", std::uint64_t(0), result.trace.steps[1].duration_ns);
+    ASSERT_TRUE("JSON unchanged", to_json(result).find("duration_ns") == std::string::npos);
+}
+
+void test_profile_finds_slow_policy() {
+    std::cout << "\n[ProfileFindsSlowPolicy]\n";
+    auto engine = make_engine();
+    engine.enable_profiling();
+    for (int i = 0; i < 20; ++i) engine.decide(request());
+    engine.evaluate(request());
+
+    const auto profile = engine.profile_snapshot();
+    ASSERT_EQ("one histogram per policy", std::size_t(2), profile.policies.size());
+    ASSERT_EQ("every invocation timed", std::uint64_t(21), profile.policies[1].latency.count());
+    ASSERT_TRUE("slow policy p50 >= 200 us", profile.policies[1].latency.percentile(0.5) >= 200000);
+    ASSERT_TRUE("fast policy p50 < 50 us", profile.policies[0].latency.percentile(0.5) < 50000);
+    ASSERT_EQ("steps untimed without step_durations", std::uint64_t(0),
+              engine.evaluate(request()).trace.steps[1].duration_ns);
+
+    const auto json = to_json(profile);
+    ASSERT_TRUE("JSON names the policy", json.find("\"policy\": \"Slow\"") != std::string::npos);
+    ASSERT_TRUE("JSON exports p999", json.find("\"p999_ns\": ") != std::string::npos);
+}
+
+void test_step_durations() {
+    std::cout << "\n[StepDurations]\n";
+    auto engine = make_engine();
+    engine.enable_profiling(true);
+
+    const auto result = engine.evaluate(request());
+    ASSERT_TRUE("slow step timed", result.trace.steps[1].duration_ns >= 200000);
+    ASSERT_TRUE("JSON carries duration_ns", to_json(result).find("\"duration_ns\": ") != std::string::npos);
+
+    TraceArena arena;
+    const auto view = engine.evaluate(request(), arena);
+    ASSERT_TRUE("arena steps timed", view.trace[1].duration_ns >= 200000);
+    ASSERT_EQ("to_step keeps the duration", view.trace[1].duration_ns, view.trace[1].to_step().duration_ns);
+}
+
+void test_threads_merged() {
+    std::cout << "\n[ThreadsMerged]\n";
+    PolicyEngine engine;
+    engine.register_policy({
+        "Allow", "1.0", "test", "",
+        [](const RequestContext&) -> std::optional<PolicyDecision> {
+            return PolicyDecision{ Effect::Allow, "Allow", "" };
+        },
+    });
+    engine.enable_profiling();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&engine] { for (int i = 0; i < 5000; ++i) engine.decide(request()); });
+    for (auto& t : threads) t.join();
+    ASSERT_EQ("histograms merged across threads", std::uint64_t(20000),
+              engine.profile_snapshot().policies[0].latency.count());
+
+    engine.register_policy({
+        "Late", "1.0", "test", "",
+        [](const RequestContext&) -> std::optional<PolicyDecision> { return std::nullopt; },
+    });
+    ASSERT_EQ("registering starts a new profile", std::uint64_t(0),
+              engine.profile_snapshot().policies[0].latency.count());
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Policy Profiler Tests ===\n";
+
+    test_histogram_buckets();
+    test_histogram_percentiles();
+    test_disabled();
+    test_profile_finds_slow_policy();
+    test_step_durations();
+    test_threads_merged();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
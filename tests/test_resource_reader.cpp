@@ -0,0 +1,221 @@
+#include "governance/compliance.hpp"
+#include "governance/json.hpp"
+#include "governance/resource_reader.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+// Reads every record, collecting the messages of rejected lines.
+static std::vector<Resource> read_all(const std::string& text, std::vector<std::string>* errors = nullptr) {
+    std::istringstream in(text);
+    ResourceReader reader(in);
+    std::vector<Resource> out;
+    Resource r;
+    for (;;) {
+        try {
+            if (!reader.next(r)) break;
+            out.push_back(r);
+        } catch (const std::runtime_error& e) {
+            if (errors) errors->push_back(e.what());
+        }
+    }
+    return out;
+}
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_basic_records() {
+    std::cout << "\n[BasicRecords]\n";
+    const auto rs = read_all(
+        "{\"id\": \"db-1\", \"type\": \"database\", \"classification\": \"restricted\", \"tags\": {\"owner\": \"team-a\"}}\n"
+        "{\"tags\":{},\"classification\":\"public\",\"type\":\"storage\",\"id\":\"s-1\"}\n");
+    ASSERT_EQ("two records", static_cast<std::size_t>(2), rs.size());
+    if (rs.size() != 2) return;
+    ASSERT_EQ("id", std::string("db-1"), rs[0].id);
+    ASSERT_TRUE("type interned", rs[0].type == symbols::type_database);
+    ASSERT_TRUE("classification interned", rs[0].classification == symbols::class_restricted);
+    ASSERT_EQ("tag value", std::string("team-a"), rs[0].tags.at("owner"));
+    ASSERT_EQ("members in any order", std::string("s-1"), rs[1].id);
+    ASSERT_TRUE("empty tags", rs[1].tags.empty());
+}
+
+void test_lenient_input() {
+    std::cout << "\n[LenientInput]\n";
+    const auto rs = read_all(
+        "\n"
+        "   \r\n"
+        "{\"id\": \"a\", \"extra\": {\"nested\": [1, -2.5e3, true, false, null, \"x\\\"y\"]}, \"type\": \"compute\"}\r\n"
+        "{\"id\": \"b\", \"classification\": null, \"tags\": null}\n"
+        "{\"id\": \"c\"}");   // no trailing newline
+    ASSERT_EQ("blank lines skipped", static_cast<std::size_t>(3), rs.size());
+    if (rs.size() != 3) return;
+    ASSERT_TRUE("unknown members skipped", rs[0].id == "a" && rs[0].type == symbols::type_compute);
+    ASSERT_TRUE("null reads as empty", rs[1].classification.empty());
+    ASSERT_TRUE("null tags read as none", rs[1].tags.empty());
+    ASSERT_TRUE("missing members empty", rs[2].id == "c" && rs[2].type.empty() && rs[2].tags.empty());
+}
+
+void test_escapes() {
+    std::cout << "\n[Escapes]\n";
+    const auto rs = read_all(
+        "{\"id\": \"q\\\"b\\\\s\\/n\\nt\\t\", \"tags\": {\"note\": \"caf\\u00e9 \\u20ac \\ud83d\\ude00\"}}\n");
+    ASSERT_EQ("one record", static_cast<std::size_t>(1), rs.size());
+    if (rs.size() != 1) return;
+    ASSERT_EQ("simple escapes", std::string("q\"b\\s/n\nt\t"), rs[0].id);
+    ASSERT_EQ("\\u escapes to UTF-8", std::string("caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80"),
+              rs[0].tags.at("note"));
+}
+
+void test_malformed_lines() {
+    std::cout << "\n[MalformedLines]\n";
+    std::vector<std::string> errors;
+    const auto rs = read_all(
+        "{\"id\": \"ok-1\"}\n"
+        "{\"id\": \"bad\",\n"
+        "not json\n"
+        "{\"id\": \"x\"} trailing\n"
+        "{\"id\": \"\\ud800\"}\n"
+        "{\"tags\": {\"k\": 1}}\n"
+        "{\"id\": \"ok-2\"}\n",
+        &errors);
+    ASSERT_EQ("good records survive", static_cast<std::size_t>(2), rs.size());
+    ASSERT_TRUE("reading continues past errors", rs.size() == 2 && rs[1].id == "ok-2");
+    ASSERT_EQ("one error per bad line", static_cast<std::size_t>(5), errors.size());
+    ASSERT_TRUE("error names its line", !errors.empty() && errors[0].rfind("line 2: ", 0) == 0);
+}
+
+void test_long_lines() {
+    std::cout << "\n[LongLines]\n";
+    // A line several times the initial buffer, between two short ones.
+    const std::string value(3 * ResourceReader::kBufferSize + 17, 'v');
+    const auto rs = read_all("{\"id\": \"a\"}\n{\"id\": \"b\", \"tags\": {\"big\": \"" + value +
+                             "\"}}\n{\"id\": \"c\"}\n");
+    ASSERT_EQ("three records", static_cast<std::size_t>(3), rs.size());
+    ASSERT_TRUE("long value intact", rs.size() == 3 && rs[1].tags.at("big") == value);
+    ASSERT_TRUE("following line intact", rs.size() == 3 && rs[2].id == "c");
+
+    // Past kMaxLine the line is rejected and skipped, and reading resumes.
+    std::vector<std::string> errors;
+    const auto after = read_all("{\"id\": \"" + std::string(ResourceReader::kMaxLine, 'x') +
+                                "\"}\n{\"id\": \"d\"}\n", &errors);
+    ASSERT_TRUE("overlong line rejected", errors.size() == 1 && errors[0] == "line 1: longer than kMaxLine");
+    ASSERT_TRUE("next line read", after.size() == 1 && after[0].id == "d");
+}
+
+void test_buffer_reuse() {
+    std::cout << "\n[BufferReuse]\n";
+    std::istringstream in(
+        "{\"id\": \"r1\", \"tags\": {\"owner\": \"a\", \"env\": \"prod\"}}\n"
+        "{\"id\": \"r2\", \"tags\": {\"env\": \"dev\", \"owner\": \"b\"}}\n"
+        "{\"id\": \"r3\", \"tags\": {\"owner\": \"c\"}}\n"
+        "{\"id\": \"r4\", \"tags\": {\"owner\": \"d\", \"owner\": \"e\"}}\n");
+    ResourceReader reader(in);
+    Resource r;
+    reader.next(r);
+    const char* storage = r.tags.at("owner").data();   // the first value read
+    reader.next(r);
+    ASSERT_TRUE("tag storage reused", r.tags.at("env").data() == storage);
+    ASSERT_TRUE("values updated", r.tags.at("owner") == "b" && r.tags.at("env") == "dev");
+    reader.next(r);
+    ASSERT_TRUE("dropped key removed", r.tags.size() == 1 && r.tags.at("owner") == "c");
+    reader.next(r);
+    ASSERT_TRUE("repeated key: last wins", r.tags.size() == 1 && r.tags.at("owner") == "e");
+    ASSERT_EQ("line number", static_cast<std::size_t>(4), reader.line());
+}
+
+void test_symbol_budget() {
+    std::cout << "\n[SymbolBudget]\n";
+    // Three values nothing has interned, against a budget of two.
+    std::istringstream in(
+        "{\"id\": \"r1\", \"type\": \"reader-budget-type-1\"}\n"
+        "{\"id\": \"r2\", \"type\": \"database\", \"tags\": {\"reader-budget-key\": \"x\"}}\n"
+        "{\"id\": \"r3\", \"type\": \"reader-budget-type-2\"}\n"
+        "{\"id\": \"r4\", \"type\": \"reader-budget-type-1\", \"tags\": {\"owner\": \"a\"}}\n");
+    ResourceReader reader(in, 2);
+    Resource r;
+    const auto symbols_before = Symbol::table_size();
+    ASSERT_TRUE("first new value accepted", reader.next(r) && r.type == "reader-budget-type-1");
+    ASSERT_TRUE("second new value accepted", reader.next(r) && r.tags.contains("reader-budget-key"));
+
+    std::string error;
+    try {
+        reader.next(r);
+    } catch (const std::runtime_error& e) {
+        error = e.what();
+    }
+    ASSERT_TRUE("third new value rejects the line", error.find("line 3:") == 0);
+    ASSERT_EQ("symbol table grew by the budget only", symbols_before + 2, Symbol::table_size());
+    ASSERT_TRUE("known values still accepted", reader.next(r) && r.id == "r4" && r.tags.contains("owner"));
+}
+
+void test_json_lines_output() {
+    std::cout << "\n[JsonLinesOutput]\n";
+    auto checker = default_compliance_checker();
+    std::ostringstream os;
+    write_json_line(os, checker.evaluate(Resource { "db-\"1\"", "database", "public", {} }));
+    write_json_line(os, checker.evaluate(Resource { "ok", "storage", "internal", {{"owner", "t"}} }));
+    const std::string out = os.str();
+
+    ASSERT_EQ("one line per report", static_cast<std::size_t>(2),
+              static_cast<std::size_t>(std::count(out.begin(), out.end(), '\n')));
+    ASSERT_TRUE("compact report",
+                out.rfind("{\"resource_id\":\"db-\\\"1\\\"\",\"compliant\":false,\"violations\":"
+                          "[\"[RequiresOwnerTag] Resource must have an 'owner' tag.\",", 0) == 0);
+    ASSERT_TRUE("compliant report",
+                out.find("{\"resource_id\":\"ok\",\"compliant\":true,\"violations\":[]}\n") != std::string::npos);
+    ASSERT_EQ("control characters escaped", std::string("a\\u0001b"), json_detail::escape("a\x01" "b"));
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Resource Reader Tests ===\n";
+
+    test_basic_records();
+    test_lenient_input();
+    test_escapes();
+    test_malformed_lines();
+    test_long_lines();
+    test_buffer_reuse();
+    test_symbol_budget();
+    test_json_lines_output();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
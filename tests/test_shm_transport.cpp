@@ -0,0 +1,335 @@
+#include "governance/shm_transport.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+static std::vector<RequestContext> request_mix() {
+    Resource patient_db  { "db-patient-records",  "database", "restricted",   {} };
+    Resource public_docs { "storage-public-docs", "storage",  "public",       {} };
+    Resource prod_api    { "compute-prod-api",    "compute",  "confidential", {} };
+
+    Principal alice { "alice@corp.io", "admin",    "IT"         };
+    Principal bob   { "bob@corp.io",   "engineer", "Backend"    };
+    Principal dave  { "dave@corp.io",  "guest",    "Consulting" };
+
+    return {
+        { alice, patient_db,  {"read"},  "production", true  },
+        { bob,   prod_api,    {"write"}, "production", false },
+        { bob,   prod_api,    {"write"}, "staging",    false },
+        { dave,  public_docs, {"read"},  "dev",        false },
+        { bob,   patient_db,  {"read"},  "staging",    true  },
+    };
+}
+
+// A channel served by a ShmServer on a background thread.
+struct Served {
+    explicit Served(const PolicyEngine& engine, std::uint32_t slots = ShmChannel::kDefaultSlots)
+        : client(make(engine, slots)) {}
+
+    ~Served() {
+        stop = true;
+        if (server.joinable()) server.join();
+    }
+
+    ShmClient make(const PolicyEngine& engine, std::uint32_t slots) {
+        auto channel = ShmChannel::create(slots);
+        auto served  = ShmChannel::attach(::dup(channel.fd()));
+        server = std::thread([this, &engine, s = std::move(served)]() mutable {
+            ShmServer(engine, std::move(s)).run(stop);
+        });
+        return ShmClient(std::move(channel));
+    }
+
+    std::atomic<bool> stop { false };
+    std::thread       server;
+    ShmClient         client;
+};
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_ring() {
+    std::cout << "\n[SpscRing]\n";
+    RingPositions positions;
+    std::vector<std::uint8_t> slots(4 * 8);
+    SpscRing producer(SpscRing::Side::Producer, &positions, slots.data(), 4, 8);
+    SpscRing consumer(SpscRing::Side::Consumer, &positions, slots.data(), 4, 8);
+
+    ASSERT_TRUE("empty ring has nothing to read", consumer.try_read() == nullptr);
+    for (std::uint8_t i = 0; i < 4; ++i) {
+        std::uint8_t* slot = producer.try_claim();
+        ASSERT_TRUE("claim while not full", slot != nullptr);
+        if (slot) *slot = i;
+    }
+    ASSERT_TRUE("full ring refuses a claim", producer.try_claim() == nullptr);
+    ASSERT_TRUE("claimed slots are invisible until published", consumer.try_read() == nullptr);
+
+    producer.publish();
+    const std::uint8_t* first  = consumer.try_read();
+    const std::uint8_t* second = consumer.try_read();
+    ASSERT_TRUE("reads in order", first && second && *first == 0 && *second == 1);
+    ASSERT_TRUE("read slots stay owned until released", producer.try_claim() == nullptr);
+
+    consumer.release();
+    std::uint8_t* wrapped = producer.try_claim();
+    ASSERT_TRUE("released slots are reused", wrapped == slots.data());
+    if (wrapped) *wrapped = 4;
+    producer.publish();
+    const std::uint8_t* third  = consumer.try_read();
+    const std::uint8_t* fourth = consumer.try_read();
+    const std::uint8_t* fifth  = consumer.try_read();
+    ASSERT_TRUE("wraps around", third && fourth && fifth &&
+                                *third == 2 && *fourth == 3 && *fifth == 4);
+    ASSERT_TRUE("drained", consumer.try_read() == nullptr);
+}
+
+void test_round_trips() {
+    std::cout << "\n[RoundTrips]\n";
+    const auto engine = default_policy_engine();
+    const auto mix    = request_mix();
+    Served served(engine);
+
+    std::size_t mismatches = 0;
+    for (const auto& ctx : mix) {
+        if (served.client.decide(ctx) != engine.decide(ctx)) ++mismatches;
+    }
+    ASSERT_EQ("decide() matches the engine", std::size_t(0), mismatches);
+}
+
+void test_pipelined() {
+    std::cout << "\n[Pipelined]\n";
+    const auto engine = default_policy_engine();
+    const auto mix    = request_mix();
+    // A small ring, so both rings fill and wrap many times.
+    Served served(engine, 16);
+
+    constexpr std::uint32_t kRequests = 100000;
+    std::uint32_t sent = 0, received = 0, out_of_order = 0, mismatches = 0;
+    wire::Response response;
+    Backoff backoff;
+    while (received < kRequests) {
+        while (sent < kRequests && served.client.submit(sent, mix[sent % mix.size()])) ++sent;
+        served.client.flush();
+        if (!served.client.poll(response)) {
+            backoff.pause();
+            continue;
+        }
+        backoff.reset();
+        do {
+            if (response.id != received) ++out_of_order;
+            if (response.status != wire::Status::Ok ||
+                response.effect != engine.decide(mix[response.id % mix.size()])) {
+                ++mismatches;
+            }
+            ++received;
+        } while (served.client.poll(response));
+    }
+    ASSERT_EQ("responses arrive in request order", 0u, out_of_order);
+    ASSERT_EQ("every effect matches the engine", 0u, mismatches);
+}
+
+void test_oversized_request() {
+    std::cout << "\n[OversizedRequest]\n";
+    const auto engine = default_policy_engine();
+    Served served(engine);
+    auto ctx = request_mix()[0];
+    ctx.resource.tags.set("note", std::string(ShmChannel::kDefaultRequestSlot, 'x'));
+
+    bool threw = false;
+    try {
+        served.client.submit(1, ctx);
+    } catch (const std::length_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE("request larger than a slot throws", threw);
+    ASSERT_EQ("channel still usable", engine.decide(request_mix()[1]),
+              served.client.decide(request_mix()[1]));
+}
+
+void test_attach_validation() {
+    std::cout << "\n[AttachValidation]\n";
+    auto expect_rejected = [](int fd) {
+        try {
+            ShmChannel::attach(fd);
+        } catch (const std::invalid_argument&) {
+            return true;
+        } catch (const std::system_error&) {
+            return true;
+        }
+        return false;
+    };
+
+    const int unsealed = ::memfd_create("test", MFD_CLOEXEC);
+    ASSERT_TRUE("unsealed memfd rejected",
+                unsealed >= 0 && ::ftruncate(unsealed, 1 << 16) == 0 && expect_rejected(unsealed));
+
+    const int garbage = ::memfd_create("test", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    ASSERT_TRUE("sealed memfd without a channel header rejected",
+                garbage >= 0 && ::ftruncate(garbage, 1 << 16) == 0 &&
+                ::fcntl(garbage, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW) == 0 &&
+                expect_rejected(garbage));
+
+    auto channel = ShmChannel::create(100);
+    bool attached = false;
+    try {
+        ShmChannel::attach(::dup(channel.fd()));
+        attached = true;
+    } catch (const std::exception&) {}
+    ASSERT_TRUE("created channel attaches (slots rounded up)", attached);
+
+    // The client can rewrite the header after the server has checked it; the
+    // server's rings must keep the layout it checked.
+    auto served = ShmChannel::attach(::dup(channel.fd()));
+    void* base  = ::mmap(nullptr, 4096, PROT_READ | PROT_WRITE, MAP_SHARED, channel.fd(), 0);
+    ASSERT_TRUE("header mapped", base != MAP_FAILED);
+    if (base != MAP_FAILED) {
+        std::memset(static_cast<char*>(base) + 12, 0x7f, 28);   // slots .. response_offset
+        ::munmap(base, 4096);
+    }
+    ASSERT_EQ("rings ignore a rewritten header", ShmChannel::kDefaultRequestSlot,
+              served.requests(SpscRing::Side::Consumer).slot_size());
+}
+
+void test_detach_ends_server() {
+    std::cout << "\n[DetachEndsServer]\n";
+    const auto engine = default_policy_engine();
+    std::atomic<bool> stop { false };
+    std::atomic<bool> returned { false };
+    std::thread server;
+    {
+        auto channel = ShmChannel::create();
+        auto served  = ShmChannel::attach(::dup(channel.fd()));
+        server = std::thread([&, s = std::move(served)]() mutable {
+            ShmServer(engine, std::move(s)).run(stop);
+            returned = true;
+        });
+        ShmClient client(std::move(channel));
+        client.decide(request_mix()[0]);
+    }   // ~ShmClient detaches
+
+    for (int i = 0; i < 2000 && !returned; ++i) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ASSERT_TRUE("run() returns once the client detaches", returned.load());
+    stop = true;
+    server.join();
+}
+
+void test_server_gone_fails_decide() {
+    std::cout << "\n[ServerGoneFailsDecide]\n";
+    const std::string path = "/tmp/governance_test_shm_" + std::to_string(::getpid()) + ".sock";
+    ::unlink(path.c_str());
+    sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    const int listener = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    const bool listening =
+        listener >= 0 &&
+        ::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0 &&
+        ::listen(listener, 1) == 0;
+    ASSERT_TRUE("listening", listening);
+    if (!listening) return;
+
+    // A daemon that accepts the channel, waits for a request and then dies
+    // without answering it.
+    std::atomic<bool> saw_request { false };
+    std::thread daemon([&] {
+        const int conn = ::accept(listener, nullptr, nullptr);
+        char byte;
+        iovec iov { &byte, 1 };
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+        msghdr msg {};
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = control;
+        msg.msg_controllen = sizeof(control);
+        if (conn < 0 || ::recvmsg(conn, &msg, 0) != 1) {
+            if (conn >= 0) ::close(conn);
+            return;
+        }
+        int fd;
+        std::memcpy(&fd, CMSG_DATA(CMSG_FIRSTHDR(&msg)), sizeof(int));
+        auto channel = ShmChannel::attach(fd);
+        if (::write(conn, &byte, 1) != 1) {
+            ::close(conn);
+            return;
+        }
+        SpscRing requests = channel.requests(SpscRing::Side::Consumer);
+        while (!requests.try_read()) std::this_thread::yield();
+        saw_request = true;
+        ::close(conn);
+    });
+
+    bool threw = false;
+    try {
+        auto client = ShmClient::connect(path);
+        ASSERT_TRUE("server alive after the handshake", !client.server_gone());
+        client.decide(request_mix()[0]);
+    } catch (const std::system_error&) {
+        threw = true;
+    }
+    daemon.join();
+    ::close(listener);
+    ::unlink(path.c_str());
+
+    ASSERT_TRUE("request reached the server", saw_request.load());
+    ASSERT_TRUE("decide() throws once the server is gone", threw);
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Shared-Memory Transport Tests ===\n";
+
+    test_ring();
+    test_round_trips();
+    test_pipelined();
+    test_oversized_request();
+    test_attach_validation();
+    test_detach_ends_server();
+    test_server_gone_fails_decide();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
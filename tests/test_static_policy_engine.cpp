@@ -0,0 +1,183 @@
+#include "governance/static_policy_engine.hpp"
+#include "governance/json.hpp"
+
+#include <iostream>
+#include <string>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+struct GuestDocsRead {
+    static constexpr const char*  name        = "GuestDocsRead";
+    static constexpr const char*  version     = "1.0";
+    static constexpr const char*  author      = "test";
+    static constexpr const char*  description = "Guests may read storage.";
+    static constexpr AttributeSet reads { Attribute::Role, Attribute::ResourceType, Attribute::Verb };
+
+    std::optional<PolicyDecision> operator()(const RequestContext& ctx) const {
+        if (ctx.principal.role == symbols::role_guest &&
+            ctx.resource.type == symbols::type_storage &&
+            ctx.action.verb == symbols::verb_read)
+            return PolicyDecision{ Effect::Allow, name, "Guest storage read." };
+        return std::nullopt;
+    }
+};
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_matches_dynamic_engine() {
+    std::cout << "\n[MatchesDynamicEngine]\n";
+    const DefaultStaticPolicyEngine static_engine;
+    const auto dynamic_engine = default_policy_engine();
+
+    std::size_t decision_mismatches = 0;
+    std::size_t trace_mismatches    = 0;
+    for (const char* role : { "admin", "engineer", "analyst", "guest" })
+    for (const char* cls  : { "public", "internal", "confidential", "restricted" })
+    for (const char* verb : { "read", "write", "delete", "execute" })
+    for (const char* env  : { "production", "staging", "dev" })
+    for (bool mfa : { false, true }) {
+        RequestContext ctx;
+        ctx.principal    = { "p", role, "dept" };
+        ctx.resource     = { "r", "database", cls, {} };
+        ctx.action       = { verb };
+        ctx.environment  = env;
+        ctx.mfa_verified = mfa;
+
+        auto expected = dynamic_engine.evaluate(ctx);
+        auto actual   = static_engine.evaluate(ctx);
+        if (actual.decision.effect      != expected.decision.effect ||
+            actual.decision.policy_name != expected.decision.policy_name ||
+            actual.decision.reason      != expected.decision.reason ||
+            static_engine.decide(ctx)   != expected.decision.effect)
+            ++decision_mismatches;
+        if (to_json(actual) != to_json(expected)) ++trace_mismatches;
+    }
+    ASSERT_EQ("decisions identical to default_policy_engine()",
+              static_cast<std::size_t>(0), decision_mismatches);
+    ASSERT_EQ("serialized traces identical to default_policy_engine()",
+              static_cast<std::size_t>(0), trace_mismatches);
+}
+
+void test_metadata() {
+    std::cout << "\n[Metadata]\n";
+    ASSERT_EQ("five built-in policies",
+              static_cast<std::size_t>(5), DefaultStaticPolicyEngine::policy_count());
+    ASSERT_TRUE("reads() is the union of declared reads",
+                DefaultStaticPolicyEngine::reads() == default_policy_engine().reads());
+
+    auto policy = make_policy<builtin::AdminFullAccess>();
+    ASSERT_EQ("make_policy copies name", std::string("AdminFullAccess"), policy.name);
+    ASSERT_EQ("make_policy copies version", std::string("1.0"), policy.version);
+    ASSERT_TRUE("make_policy copies reads", policy.reads == builtin::AdminFullAccess::reads);
+}
+
+void test_custom_static_policy() {
+    std::cout << "\n[CustomStaticPolicy]\n";
+    StaticPolicyEngine<builtin::MFARequiredForRestricted, GuestDocsRead> engine;
+
+    RequestContext ctx;
+    ctx.principal   = { "dave", "guest", "Consulting" };
+    ctx.resource    = { "docs", "storage", "public", {} };
+    ctx.action      = { "read" };
+    ctx.environment = "dev";
+
+    auto result = engine.evaluate(ctx);
+    ASSERT_EQ("guest storage read -> Allow", Effect::Allow, result.decision.effect);
+    ASSERT_EQ("trace has 2 steps", static_cast<std::size_t>(2), result.trace.steps.size());
+    ASSERT_EQ("first step abstains", StepOutcome::Abstain, result.trace.steps[0].outcome);
+
+    ctx.resource.classification = "restricted";
+    result = engine.evaluate(ctx);
+    ASSERT_EQ("restricted without MFA -> Deny", Effect::Deny, result.decision.effect);
+    ASSERT_EQ("deny short-circuits the trace", static_cast<std::size_t>(1), result.trace.steps.size());
+    ASSERT_EQ("decide agrees", Effect::Deny, engine.decide(ctx));
+
+    auto dynamic = engine.to_policy_engine();
+    ASSERT_EQ("to_policy_engine registers both", static_cast<std::size_t>(2), dynamic.policy_count());
+    ASSERT_EQ("to_policy_engine agrees", Effect::Deny, dynamic.decide(ctx));
+}
+
+void test_builtin_views() {
+    std::cout << "\n[BuiltinViews]\n";
+    RequestContext ctx;
+    ctx.principal   = { "carol", "analyst", "DataSci" };
+    ctx.resource    = { "db", "database", "restricted", {} };
+    ctx.action      = { "read" };
+    ctx.environment = "production";
+
+    const builtin::AnalystReadOnly policy;
+    auto first  = policy(ctx);
+    auto second = policy(ctx);
+    ASSERT_TRUE("built-in decides", first.has_value() && second.has_value());
+    ASSERT_TRUE("reason points at static storage",
+                first->reason.data() == second->reason.data());
+    ASSERT_TRUE("name points at the type's name",
+                first->policy_name.data() == builtin::AnalystReadOnly::name);
+
+    auto owned = first->to_decision();
+    ASSERT_EQ("owning conversion keeps effect", Effect::Deny, owned.effect);
+    ASSERT_EQ("owning conversion keeps reason", std::string(first->reason), owned.reason);
+
+    auto wrapped = make_policy<builtin::AnalystReadOnly>();
+    ASSERT_TRUE("make_policy sets evaluate_view for view types", static_cast<bool>(wrapped.evaluate_view));
+    ASSERT_TRUE("make_policy still sets evaluate", static_cast<bool>(wrapped.evaluate));
+    ASSERT_EQ("both forms agree", wrapped.evaluate(ctx)->reason,
+              std::string(wrapped.evaluate_view(ctx)->reason));
+
+    auto custom = make_policy<GuestDocsRead>();
+    ASSERT_TRUE("owning policy types get no evaluate_view", !custom.evaluate_view);
+}
+
+void test_empty_chain_denies() {
+    std::cout << "\n[EmptyChainDenies]\n";
+    StaticPolicyEngine<> engine;
+    RequestContext ctx;
+    ASSERT_EQ("empty chain decide -> Deny", Effect::Deny, engine.decide(ctx));
+    ASSERT_EQ("empty chain default decision",
+              std::string("default"), engine.evaluate(ctx).decision.policy_name);
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Static Policy Engine Tests ===\n";
+
+    test_matches_dynamic_engine();
+    test_metadata();
+    test_custom_static_policy();
+    test_builtin_views();
+    test_empty_chain_denies();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
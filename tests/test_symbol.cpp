@@ -0,0 +1,134 @@
+#include "governance/symbol.hpp"
+#include "governance/types.hpp"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace governance;
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_interning() {
+    std::cout << "\n[Interning]\n";
+    Symbol a { "payments-team" };
+    Symbol b { std::string("payments-team") };
+    Symbol c { "billing-team" };
+
+    ASSERT_TRUE("same text -> same id", a.id() == b.id());
+    ASSERT_TRUE("different text -> different id", a.id() != c.id());
+    ASSERT_EQ("str() round-trips", std::string("payments-team"), a.str());
+    ASSERT_TRUE("default symbol is empty", Symbol().empty());
+    ASSERT_TRUE("\"\" interns to the empty symbol", Symbol("") == Symbol());
+}
+
+void test_well_known_symbols() {
+    std::cout << "\n[WellKnownSymbols]\n";
+    ASSERT_TRUE("\"admin\" -> role_admin",               Symbol("admin") == symbols::role_admin);
+    ASSERT_TRUE("\"secret\" -> type_secret",             Symbol("secret") == symbols::type_secret);
+    ASSERT_TRUE("\"restricted\" -> class_restricted",    Symbol("restricted") == symbols::class_restricted);
+    ASSERT_TRUE("\"delete\" -> verb_delete",             Symbol("delete") == symbols::verb_delete);
+    ASSERT_TRUE("\"dev\" -> env_dev",                    Symbol("dev") == symbols::env_dev);
+    ASSERT_EQ("env_production text", std::string("production"), symbols::env_production.str());
+    ASSERT_TRUE("well-known ids are dense",
+                symbols::env_dev.id() + 1 == symbols::well_known_count);
+}
+
+void test_text_comparison() {
+    std::cout << "\n[TextComparison]\n";
+    Symbol role { "engineer" };
+    ASSERT_TRUE("symbol == literal",     role == "engineer");
+    ASSERT_TRUE("literal == symbol",     "engineer" == role);
+    ASSERT_TRUE("symbol == std::string", role == std::string("engineer"));
+    ASSERT_TRUE("symbol != literal",     role != "analyst");
+
+    const auto before = Symbol::table_size();
+    ASSERT_TRUE("comparison with unknown text is false", role != "never-interned-text");
+    ASSERT_TRUE("lookup of unknown text -> nullopt",
+                !Symbol::lookup("never-interned-text").has_value());
+    ASSERT_EQ("comparison and lookup do not grow the table", before, Symbol::table_size());
+    ASSERT_TRUE("lookup of known text", Symbol::lookup("engineer") == role);
+}
+
+void test_context_attributes() {
+    std::cout << "\n[ContextAttributes]\n";
+    RequestContext ctx;
+    ctx.principal   = { "bob", "engineer", "Backend" };
+    ctx.resource    = { "db", "database", "confidential", {} };
+    ctx.action      = { "read" };
+    ctx.environment = "production";
+
+    ASSERT_TRUE("role interned",           ctx.principal.role == symbols::role_engineer);
+    ASSERT_TRUE("type interned",           ctx.resource.type == symbols::type_database);
+    ASSERT_TRUE("classification interned", ctx.resource.classification == symbols::class_confidential);
+    ASSERT_TRUE("verb interned",           ctx.action.verb == symbols::verb_read);
+    ASSERT_TRUE("environment interned",    ctx.environment == symbols::env_production);
+    ASSERT_TRUE("default environment empty", RequestContext{}.environment.empty());
+}
+
+void test_concurrent_interning() {
+    std::cout << "\n[ConcurrentInterning]\n";
+    const std::size_t kThreads = 4;
+    const std::size_t kNames   = 500;
+
+    std::vector<std::vector<std::uint32_t>> ids(kThreads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            for (std::size_t i = 0; i < kNames; ++i)
+                ids[t].push_back(Symbol("team-" + std::to_string(i)).id());
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    bool consistent = true;
+    for (std::size_t t = 1; t < kThreads; ++t)
+        if (ids[t] != ids[0]) consistent = false;
+    ASSERT_TRUE("all threads observe the same ids", consistent);
+    ASSERT_EQ("ids resolve back to their text",
+              std::string("team-42"), Symbol::from_id(ids[0][42]).str());
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Symbol Tests ===\n";
+
+    test_interning();
+    test_well_known_symbols();
+    test_text_comparison();
+    test_context_attributes();
+    test_concurrent_interning();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+#include "governance/tag_set.hpp"
+#include "governance/types.hpp"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace governance;
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_lookup() {
+    std::cout << "\n[Lookup]\n";
+    const TagSet tags { { "owner", "team-a" }, { "env", "prod" } };
+    const Symbol owner("owner");
+
+    ASSERT_EQ("size", static_cast<std::size_t>(2), tags.size());
+    ASSERT_TRUE("contains by Symbol", tags.contains(owner));
+    ASSERT_TRUE("contains by text", tags.contains("env"));
+    ASSERT_EQ("count absent", static_cast<std::size_t>(0), tags.count("region"));
+    ASSERT_EQ("at", std::string("team-a"), std::string(tags.at(owner)));
+    ASSERT_TRUE("find value", tags.find("env") != tags.end() && tags.find("env")->value == "prod");
+    ASSERT_TRUE("find absent", tags.find(std::string("region")) == tags.end());
+
+    bool threw = false;
+    try {
+        tags.at("region");
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    ASSERT_TRUE("at absent throws", threw);
+
+    const auto symbols = Symbol::table_size();
+    ASSERT_TRUE("unknown text key absent", !tags.contains("never-interned-tag-key"));
+    ASSERT_EQ("text lookup never interns", symbols, Symbol::table_size());
+
+    bool sorted = true;
+    Symbol previous;
+    for (const auto& [key, value] : tags) {
+        sorted = sorted && previous < key;
+        previous = key;
+    }
+    ASSERT_TRUE("iteration in key id order", sorted);
+}
+
+void test_set_and_erase() {
+    std::cout << "\n[Set and erase]\n";
+    TagSet tags;
+    tags.set("owner", "team-a");
+    tags.set("env", "production");
+    tags.set("owner", "b");                       // shorter: in place
+    ASSERT_EQ("overwrite shorter", std::string("b"), std::string(tags.at("owner")));
+    tags.set("owner", "a-much-longer-owner-name");   // longer: appended
+    ASSERT_EQ("overwrite longer", std::string("a-much-longer-owner-name"), std::string(tags.at("owner")));
+    ASSERT_EQ("other value intact", std::string("production"), std::string(tags.at("env")));
+    ASSERT_EQ("set existing keeps size", static_cast<std::size_t>(2), tags.size());
+
+    tags.set("env", tags.at("owner"));            // value views this set's own storage
+    ASSERT_EQ("self-aliased value", std::string("a-much-longer-owner-name"), std::string(tags.at("env")));
+
+    ASSERT_EQ("erase present", static_cast<std::size_t>(1), tags.erase("owner"));
+    ASSERT_EQ("erase absent", static_cast<std::size_t>(0), tags.erase("owner"));
+    ASSERT_TRUE("erased key gone", !tags.contains("owner"));
+    ASSERT_EQ("remaining value intact", std::string("a-much-longer-owner-name"), std::string(tags.at("env")));
+
+    // Churn one key; compaction must keep the other values readable.
+    bool intact = true;
+    for (int i = 0; i < 100; ++i) {
+        tags.set("churn", std::string(static_cast<std::size_t>(i % 17), 'x'));
+        if (i % 3 == 0) tags.erase("churn");
+        intact = intact && tags.at("env") == "a-much-longer-owner-name";
+    }
+    ASSERT_TRUE("values survive compaction", intact);
+
+    tags.clear();
+    ASSERT_TRUE("clear empties", tags.empty() && tags.begin() == tags.end());
+    tags.set("owner", "again");
+    ASSERT_EQ("usable after clear", std::string("again"), std::string(tags.at("owner")));
+}
+
+void test_spill() {
+    std::cout << "\n[Spill past inline storage]\n";
+    TagSet tags;
+    const std::size_t n = TagSet::kInlineTags * 3;
+    for (std::size_t i = 0; i < n; ++i) tags.set("spill-" + std::to_string(i), "v" + std::to_string(i));
+    ASSERT_EQ("size", n, tags.size());
+
+    bool all = true;
+    for (std::size_t i = 0; i < n; ++i) {
+        all = all && tags.at(Symbol("spill-" + std::to_string(i))) == "v" + std::to_string(i);
+    }
+    ASSERT_TRUE("every tag found by Symbol", all);
+
+    for (std::size_t i = 0; i + 2 < n; ++i) tags.erase("spill-" + std::to_string(i));
+    ASSERT_EQ("shrunk back inline", static_cast<std::size_t>(2), tags.size());
+    ASSERT_TRUE("survivors intact", tags.at("spill-" + std::to_string(n - 1)) == "v" + std::to_string(n - 1) &&
+                                    tags.at("spill-" + std::to_string(n - 2)) == "v" + std::to_string(n - 2));
+}
+
+void test_compatibility() {
+    std::cout << "\n[Map compatibility]\n";
+    const std::unordered_map<std::string, std::string> map { { "owner", "team-a" }, { "region", "eu-1" } };
+    const TagSet tags(map);
+    ASSERT_TRUE("round trip through map", tags.to_map() == map);
+
+    TagSet reordered;
+    reordered.set("region", "eu-1");
+    reordered.set("owner", "team-a");
+    ASSERT_TRUE("equality ignores insertion order", tags == reordered);
+    reordered.set("owner", "team-b");
+    ASSERT_TRUE("different value unequal", tags != reordered);
+
+    Resource r { "db-1", "database", "restricted", map };   // converts implicitly
+    Resource copy = r;
+    copy.tags.set("owner", "someone-else");
+    ASSERT_EQ("copies are independent", std::string("team-a"), std::string(r.tags.at("owner")));
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Tag Set Tests ===\n";
+
+    test_lookup();
+    test_set_and_erase();
+    test_spill();
+    test_compatibility();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+#include "governance/thread_pool.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace governance;
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_covers_every_index_once() {
+    std::cout << "\n[CoversEveryIndexOnce]\n";
+    ThreadPool pool(4);
+    ASSERT_EQ("concurrency includes caller", static_cast<std::size_t>(4), pool.concurrency());
+
+    std::vector<std::atomic<int>> hits(10007);
+    for (auto& h : hits) h.store(0);
+    pool.parallel_for(hits.size(), 100, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) hits[i].fetch_add(1);
+    });
+
+    std::size_t wrong = 0;
+    for (auto& h : hits)
+        if (h.load() != 1) ++wrong;
+    ASSERT_EQ("every index visited exactly once", static_cast<std::size_t>(0), wrong);
+}
+
+void test_repeated_loops() {
+    std::cout << "\n[RepeatedLoops]\n";
+    ThreadPool pool(3);
+    std::atomic<std::size_t> total { 0 };
+    for (int round = 0; round < 200; ++round) {
+        pool.parallel_for(1000, 10, [&](std::size_t begin, std::size_t end) {
+            total.fetch_add(end - begin);
+        });
+    }
+    ASSERT_EQ("200 loops of 1000 items", static_cast<std::size_t>(200000), total.load());
+}
+
+void test_exception_propagates() {
+    std::cout << "\n[ExceptionPropagates]\n";
+    ThreadPool pool(4);
+    bool caught = false;
+    try {
+        pool.parallel_for(1000, 10, [&](std::size_t begin, std::size_t) {
+            if (begin == 500) throw std::runtime_error("boom");
+        });
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    ASSERT_TRUE("exception rethrown on caller", caught);
+
+    std::atomic<std::size_t> total { 0 };
+    pool.parallel_for(100, 10, [&](std::size_t begin, std::size_t end) {
+        total.fetch_add(end - begin);
+    });
+    ASSERT_EQ("pool usable after exception", static_cast<std::size_t>(100), total.load());
+}
+
+void test_nested_call_runs_inline() {
+    std::cout << "\n[NestedCallRunsInline]\n";
+    ThreadPool pool(2);
+    std::atomic<std::size_t> inner { 0 };
+    pool.parallel_for(4, 1, [&](std::size_t, std::size_t) {
+        pool.parallel_for(10, 1, [&](std::size_t begin, std::size_t end) {
+            inner.fetch_add(end - begin);
+        });
+    });
+    ASSERT_EQ("nested loops complete without deadlock", static_cast<std::size_t>(40), inner.load());
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Thread Pool Tests ===\n";
+
+    test_covers_every_index_once();
+    test_repeated_loops();
+    test_exception_propagates();
+    test_nested_call_runs_inline();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+#include "governance/json.hpp"
+#include "governance/policy_engine.hpp"
+#include "governance/trace_arena.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+static RequestContext make_request(const char* principal, const char* role,
+                                   const char* classification, const char* verb,
+                                   const char* env, bool mfa) {
+    RequestContext ctx;
+    ctx.principal    = { principal, role, "dept" };
+    ctx.resource     = { "r-" + std::string(principal), "database", classification, {} };
+    ctx.action       = { verb };
+    ctx.environment  = env;
+    ctx.mfa_verified = mfa;
+    return ctx;
+}
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// Runs every request in the built-in policies' domain through both evaluate()
+// forms and counts the ones whose JSON differs.
+static std::size_t json_mismatches(const PolicyEngine& engine, TraceArena& arena) {
+    std::size_t mismatches = 0;
+    for (const char* role : { "admin", "engineer", "analyst", "guest" })
+    for (const char* cls  : { "public", "internal", "confidential", "restricted" })
+    for (const char* verb : { "read", "write", "delete" })
+    for (const char* env  : { "production", "staging", "dev" })
+    for (bool mfa : { false, true }) {
+        arena.reset();
+        auto ctx  = make_request("p", role, cls, verb, env, mfa);
+        auto view = engine.evaluate(ctx, arena);
+        if (to_json(view) != to_json(engine.evaluate(ctx)) ||
+            to_json(view.to_result()) != to_json(view))
+            ++mismatches;
+    }
+    return mismatches;
+}
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_arena_allocation() {
+    std::cout << "\n[ArenaAllocation]\n";
+    TraceArena arena(128);
+
+    auto a = arena.store("hello");
+    auto b = arena.store("world");
+    ASSERT_EQ("stored text copied", std::string("hello"), std::string(a));
+    ASSERT_TRUE("copies are distinct", a.data() != b.data());
+    ASSERT_TRUE("empty text needs no storage", arena.store("").empty());
+
+    auto* words = arena.allocate_array<std::uint64_t>(3);
+    ASSERT_EQ("arrays are aligned", static_cast<std::uintptr_t>(0),
+              reinterpret_cast<std::uintptr_t>(words) % alignof(std::uint64_t));
+
+    // A request larger than the block size gets a block of its own.
+    const std::string big(1000, 'x');
+    ASSERT_EQ("oversized text stored", big, std::string(arena.store(big)));
+    ASSERT_EQ("earlier text intact", std::string("world"), std::string(b));
+
+    const auto reserved = arena.bytes_reserved();
+    arena.reset();
+    ASSERT_EQ("reset rewinds", static_cast<std::size_t>(0), arena.bytes_used());
+    for (int i = 0; i < 3; ++i) {
+        arena.reset();
+        arena.store("hello");
+        arena.store(big);
+    }
+    ASSERT_EQ("reset keeps and reuses blocks", reserved, arena.bytes_reserved());
+}
+
+void test_views_match_owning_results() {
+    std::cout << "\n[ViewsMatchOwningResults]\n";
+    TraceArena arena;
+    auto engine = default_policy_engine();
+    ASSERT_EQ("to_json identical", static_cast<std::size_t>(0), json_mismatches(engine, arena));
+
+    engine.enable_cache(1024);
+    ASSERT_EQ("to_json identical with cache (misses)",
+              static_cast<std::size_t>(0), json_mismatches(engine, arena));
+    ASSERT_EQ("to_json identical with cache (hits)",
+              static_cast<std::size_t>(0), json_mismatches(engine, arena));
+    ASSERT_TRUE("arena path hits the cache", engine.cache_stats().hits > 0);
+}
+
+void test_view_contents() {
+    std::cout << "\n[ViewContents]\n";
+    const auto engine = default_policy_engine();
+    TraceArena arena;
+
+    auto ctx  = make_request("bob", "engineer", "confidential", "write", "production", false);
+    auto view = engine.evaluate(ctx, arena);
+    ASSERT_EQ("engineer prod write -> Deny", Effect::Deny, view.decision.effect);
+    ASSERT_EQ("denied by ProductionImmutability",
+              std::string("ProductionImmutability"), std::string(view.decision.policy_name));
+    ASSERT_EQ("trace stops at the deny", static_cast<std::size_t>(3), view.trace.size());
+    ASSERT_EQ("one policy evaluated", static_cast<std::size_t>(1), view.trace.evaluated_count());
+    ASSERT_TRUE("context is the caller's request", view.trace.context == &ctx);
+
+    auto owned = view.to_result();
+    ASSERT_EQ("owning copy keeps the reason", std::string(view.decision.reason), owned.decision.reason);
+    ASSERT_EQ("owning copy has every step", view.trace.size(), owned.trace.steps.size());
+
+    // A policy that reports another name and builds its reason on the fly.
+    PolicyEngine custom;
+    custom.register_policy({
+        "Dynamic", "1.0", "test", "Allows with a computed reason.",
+        [](const RequestContext& c) -> std::optional<PolicyDecision> {
+            return PolicyDecision{ Effect::Allow, "DynamicAlias", "hello " + c.principal.id };
+        },
+        {}
+    });
+    arena.reset();
+    auto dyn = custom.evaluate(ctx, arena);
+    ASSERT_EQ("computed reason copied into arena", std::string("hello bob"), std::string(dyn.decision.reason));
+    ASSERT_EQ("decision keeps the reported name", std::string("DynamicAlias"), std::string(dyn.decision.policy_name));
+    ASSERT_EQ("step keeps the registered name", std::string("Dynamic"), std::string(dyn.trace[0].policy_name));
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Trace Arena Tests ===\n";
+
+    test_arena_allocation();
+    test_views_match_owning_results();
+    test_view_contents();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,266 @@
+#include "governance/trace_arena.hpp"
+#include "governance/versioned_policy_engine.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+static Policy policy_with(Effect effect) {
+    const char* name = effect == Effect::Allow ? "AllowAll" : "DenyAll";
+    return {
+        name, "1.0", "test", "",
+        [effect, name](const RequestContext&) -> std::optional<PolicyDecision> {
+            return PolicyDecision{ effect, name, "fixed" };
+        },
+        {}
+    };
+}
+
+static PolicyEngine engine_with(Effect effect) {
+    PolicyEngine engine;
+    engine.register_policy(policy_with(effect));
+    return engine;
+}
+
+static RequestContext guest_read() {
+    RequestContext ctx;
+    ctx.principal   = { "dave", "guest", "Consulting" };
+    ctx.resource    = { "docs", "storage", "public", {} };
+    ctx.action      = { "read" };
+    ctx.environment = "dev";
+    return ctx;
+}
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_publish_and_update() {
+    std::cout << "\n[PublishAndUpdate]\n";
+    VersionedPolicyEngine engine(engine_with(Effect::Deny));
+    const auto ctx = guest_read();
+
+    ASSERT_EQ("initial version is 1", static_cast<std::uint64_t>(1), engine.version());
+    ASSERT_EQ("initial policy set denies", Effect::Deny, engine.decide(ctx));
+
+    ASSERT_EQ("publish returns the new version",
+              static_cast<std::uint64_t>(2), engine.publish(engine_with(Effect::Allow)));
+    ASSERT_EQ("readers see the new policy set", Effect::Allow, engine.decide(ctx));
+    ASSERT_EQ("evaluate agrees", std::string("AllowAll"), engine.evaluate(ctx).decision.policy_name);
+
+    TraceArena arena;
+    ASSERT_EQ("arena evaluate agrees", Effect::Allow, engine.evaluate(ctx, arena).decision.effect);
+
+    auto pinned = engine.snapshot();
+    engine.update([](PolicyEngine& next) { next.register_policy(policy_with(Effect::Deny)); });
+    ASSERT_EQ("update publishes version 3", static_cast<std::uint64_t>(3), engine.version());
+    ASSERT_EQ("update extends the latest snapshot",
+              static_cast<std::size_t>(2), engine.snapshot()->policy_count());
+    ASSERT_EQ("deny added by update wins", Effect::Deny, engine.decide(ctx));
+    ASSERT_EQ("pinned snapshot keeps its policy set", Effect::Allow, pinned->decide(ctx));
+}
+
+void test_old_snapshots_reclaimed() {
+    std::cout << "\n[OldSnapshotsReclaimed]\n";
+    VersionedPolicyEngine engine(engine_with(Effect::Deny));
+    const auto ctx = guest_read();
+
+    std::weak_ptr<const PolicyEngine> first = engine.snapshot();
+    engine.decide(ctx);
+    engine.publish(engine_with(Effect::Allow));
+    ASSERT_TRUE("old snapshot alive while this thread still caches it", !first.expired());
+    engine.decide(ctx);
+    ASSERT_TRUE("old snapshot freed once the reader moves on", first.expired());
+
+    // A thread that exits releases its cached snapshot too.
+    std::weak_ptr<const PolicyEngine> second = engine.snapshot();
+    std::thread([&] { engine.decide(ctx); }).join();
+    engine.publish(engine_with(Effect::Deny));
+    engine.decide(ctx);
+    ASSERT_TRUE("snapshot freed after reader thread exited", second.expired());
+}
+
+void test_concurrent_swaps() {
+    std::cout << "\n[ConcurrentSwaps]\n";
+    VersionedPolicyEngine engine(engine_with(Effect::Deny));
+    const auto ctx = guest_read();
+
+    std::atomic<bool> stop { false };
+    std::atomic<std::size_t> regressions { 0 };
+    std::atomic<std::size_t> evaluations { 0 };
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            std::uint64_t last = 0;
+            while (!stop.load()) {
+                // Versions a thread observes never go backwards, and every
+                // evaluation runs against a complete policy set.
+                const auto seen = engine.version();
+                if (seen < last) ++regressions;
+                last = seen;
+                auto result = engine.evaluate(ctx);
+                if (result.trace.steps.size() != 1) ++regressions;
+                evaluations.fetch_add(1);
+            }
+        });
+    }
+
+    std::vector<std::weak_ptr<const PolicyEngine>> published;
+    for (int i = 0; i < 200; ++i) {
+        engine.publish(engine_with(i % 2 ? Effect::Deny : Effect::Allow));
+        published.push_back(engine.snapshot());
+    }
+    while (evaluations.load() < 1000) std::this_thread::yield();
+    stop.store(true);
+    for (auto& r : readers) r.join();
+
+    ASSERT_EQ("201 versions", static_cast<std::uint64_t>(201), engine.version());
+    ASSERT_EQ("no torn or stale reads", static_cast<std::size_t>(0), regressions.load());
+    ASSERT_EQ("latest policy set visible", Effect::Deny, engine.decide(ctx));
+
+    std::size_t alive = 0;
+    for (auto& w : published)
+        if (!w.expired()) ++alive;
+    ASSERT_EQ("only the current snapshot survives the readers", static_cast<std::size_t>(1), alive);
+}
+
+void test_many_engines_per_thread() {
+    std::cout << "\n[ManyEnginesPerThread]\n";
+    const auto ctx = guest_read();
+
+    // More engines than the per-thread cache has direct slots, so some ids
+    // collide; each must still answer from its own policy set.
+    std::vector<std::unique_ptr<VersionedPolicyEngine>> engines;
+    for (int i = 0; i < 8; ++i)
+        engines.push_back(std::make_unique<VersionedPolicyEngine>(
+            engine_with(i % 2 ? Effect::Allow : Effect::Deny)));
+
+    std::size_t wrong = 0;
+    for (int round = 0; round < 3; ++round)
+        for (std::size_t i = 0; i < engines.size(); ++i)
+            if (engines[i]->decide(ctx) != (i % 2 ? Effect::Allow : Effect::Deny)) ++wrong;
+    ASSERT_EQ("interleaved engines keep their own snapshots", static_cast<std::size_t>(0), wrong);
+
+    engines[3]->publish(engine_with(Effect::Deny));
+    ASSERT_EQ("publish reaches a colliding engine", Effect::Deny, engines[3]->decide(ctx));
+    ASSERT_EQ("its neighbour is unaffected", Effect::Allow, engines[7]->decide(ctx));
+}
+
+void test_snapshots_released_with_engine() {
+    std::cout << "\n[SnapshotsReleasedWithEngine]\n";
+    const auto ctx = guest_read();
+
+    std::weak_ptr<const PolicyEngine> snapshot;
+    std::atomic<bool> cached { false };
+    std::atomic<bool> done { false };
+    std::thread reader;
+    {
+        VersionedPolicyEngine engine(engine_with(Effect::Allow));
+        engine.decide(ctx);
+        snapshot = engine.snapshot();
+
+        // A thread that outlives the engine, holding it in its cache.
+        reader = std::thread([&] {
+            engine.decide(ctx);
+            cached.store(true);
+            while (!done.load()) std::this_thread::yield();
+        });
+        while (!cached.load()) std::this_thread::yield();
+    }
+    // Both this thread and the reader still cache the engine.
+    ASSERT_TRUE("snapshot freed when the engine is destroyed", snapshot.expired());
+    done.store(true);
+    reader.join();
+
+    // The thread's cache still works for engines created afterwards.
+    VersionedPolicyEngine next(engine_with(Effect::Deny));
+    ASSERT_EQ("new engine on the same thread", Effect::Deny, next.decide(ctx));
+}
+
+void test_update_does_not_block_readers() {
+    std::cout << "\n[UpdateDoesNotBlockReaders]\n";
+    VersionedPolicyEngine engine(engine_with(Effect::Deny));
+    const auto ctx = guest_read();
+
+    // One reader caches version 1, then must refresh to version 2 while
+    // update() runs; another first uses the engine while it runs.
+    std::atomic<bool> cached { false };
+    std::atomic<bool> go { false };
+    std::atomic<int>  answered { 0 };
+    std::thread refreshing([&] {
+        engine.decide(ctx);
+        cached = true;
+        while (!go.load()) std::this_thread::yield();
+        if (engine.decide(ctx) == Effect::Allow) ++answered;
+    });
+    while (!cached.load()) std::this_thread::yield();
+    engine.publish(engine_with(Effect::Allow));
+
+    bool readers_ran = false;
+    std::thread fresh;
+    engine.update([&](PolicyEngine& next) {
+        go = true;
+        fresh = std::thread([&] {
+            if (engine.decide(ctx) == Effect::Allow) ++answered;
+        });
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (answered.load() < 2 && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        readers_ran = answered.load() == 2;
+        next.register_policy(policy_with(Effect::Deny));
+    });
+    refreshing.join();
+    fresh.join();
+    ASSERT_TRUE("readers answered while update() ran", readers_ran);
+    ASSERT_EQ("update published afterwards", Effect::Deny, engine.decide(ctx));
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Versioned Policy Engine Tests ===\n";
+
+    test_publish_and_update();
+    test_old_snapshots_reclaimed();
+    test_concurrent_swaps();
+    test_update_does_not_block_readers();
+    test_many_engines_per_thread();
+    test_snapshots_released_with_engine();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+#include "governance/wire.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace governance;
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+static RequestContext sample_request() {
+    RequestContext ctx;
+    ctx.principal    = { "bob@corp.io", "engineer", "Backend" };
+    ctx.resource     = { "compute-prod-api", "compute", "confidential",
+                         { {"owner", "platform-team"}, {"env", "production"} } };
+    ctx.action       = { "write" };
+    ctx.environment  = "production";
+    ctx.mfa_verified = true;
+    return ctx;
+}
+
+static int passed = 0;
+static int failed = 0;
+
+#define ASSERT_TRUE(label, expr)                                            \
+    do {                                                                    \
+        if ((expr)) {                                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label << "\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+#define ASSERT_EQ(label, expected, actual)                                  \
+    do {                                                                    \
+        if ((expected) == (actual)) {                                       \
+            std::cout << "  [PASS] " << label << "\n";                     \
+            ++passed;                                                       \
+        } else {                                                            \
+            std::cout << "  [FAIL] " << label                              \
+                      << "  (expected=" << (expected)                      \
+                      << " got=" << (actual) << ")\n";                     \
+            ++failed;                                                       \
+        }                                                                   \
+    } while (0)
+
+// ── Suites ────────────────────────────────────────────────────────────────────
+
+void test_request_round_trip() {
+    std::cout << "\n[RequestRoundTrip]\n";
+    const auto ctx = sample_request();
+    std::vector<std::uint8_t> frame;
+    wire::encode_request(42, ctx, frame);
+
+    auto length = wire::payload_length(frame.data(), frame.size());
+    ASSERT_TRUE("header readable", length.has_value());
+    ASSERT_EQ("length prefix covers the payload", frame.size() - wire::kHeaderSize,
+              static_cast<std::size_t>(*length));
+
+    std::uint32_t id = 0;
+    RequestContext decoded;
+    ASSERT_TRUE("decodes", wire::decode_request(frame.data() + wire::kHeaderSize, *length, id, decoded));
+    ASSERT_EQ("id", static_cast<std::uint32_t>(42), id);
+    ASSERT_EQ("principal id", ctx.principal.id, decoded.principal.id);
+    ASSERT_TRUE("role", ctx.principal.role == decoded.principal.role);
+    ASSERT_EQ("department", ctx.principal.department, decoded.principal.department);
+    ASSERT_EQ("resource id", ctx.resource.id, decoded.resource.id);
+    ASSERT_TRUE("resource type", ctx.resource.type == decoded.resource.type);
+    ASSERT_TRUE("classification", ctx.resource.classification == decoded.resource.classification);
+    ASSERT_TRUE("tags", ctx.resource.tags == decoded.resource.tags);
+    ASSERT_TRUE("verb", ctx.action.verb == decoded.action.verb);
+    ASSERT_TRUE("environment", ctx.environment == decoded.environment);
+    ASSERT_TRUE("mfa", decoded.mfa_verified);
+}
+
+void test_untrusted_input() {
+    std::cout << "\n[UntrustedInput]\n";
+    const auto ctx = sample_request();
+    std::vector<std::uint8_t> frame;
+    wire::encode_request(1, ctx, frame);
+
+    // Overwrite the role text ("engineer", after id, flags and its length
+    // byte) with a value nothing has interned.
+    const std::size_t role_at = wire::kHeaderSize + 4 + 1 + 1;
+    for (std::size_t i = 0; i < 8; ++i) frame[role_at + i] = 'q';
+    // Likewise the "owner" tag key.
+    const std::string owner = "owner";
+    const auto owner_at = std::search(frame.begin(), frame.end(), owner.begin(), owner.end());
+    std::fill(owner_at, owner_at + 5, 'q');
+
+    const auto symbols_before = Symbol::table_size();
+    std::uint32_t id;
+    RequestContext decoded;
+    const std::uint8_t* payload = frame.data() + wire::kHeaderSize;
+    const std::size_t   size    = frame.size() - wire::kHeaderSize;
+    ASSERT_TRUE("decodes", wire::decode_request(payload, size, id, decoded));
+    ASSERT_TRUE("unknown role decodes to the empty symbol", decoded.principal.role.empty());
+    ASSERT_TRUE("known values still resolve", decoded.action.verb == ctx.action.verb);
+    ASSERT_TRUE("tag with an unknown key dropped",
+                decoded.resource.tags.size() == 1 && decoded.resource.tags.contains("env"));
+    ASSERT_EQ("decoding never grows the symbol table", symbols_before, Symbol::table_size());
+
+    std::size_t truncations_accepted = 0;
+    for (std::size_t n = 0; n < size; ++n)
+        if (wire::decode_request(payload, n, id, decoded)) ++truncations_accepted;
+    ASSERT_EQ("every truncation rejected", static_cast<std::size_t>(0), truncations_accepted);
+
+    std::vector<std::uint8_t> padded(payload, payload + size);
+    padded.push_back(0);
+    ASSERT_TRUE("trailing bytes rejected", !wire::decode_request(padded.data(), padded.size(), id, decoded));
+    ASSERT_TRUE("short header incomplete", !wire::payload_length(frame.data(), 3).has_value());
+
+    auto oversized = sample_request();
+    oversized.principal.role = std::string(300, 'r');
+    std::vector<std::uint8_t> out;
+    bool threw = false;
+    try {
+        wire::encode_request(1, oversized, out);
+    } catch (const std::length_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE("oversized attribute rejected on encode", threw);
+}
+
+void test_response_round_trip() {
+    std::cout << "\n[ResponseRoundTrip]\n";
+    std::vector<std::uint8_t> stream;
+    wire::encode_response({ 7, wire::Status::Ok, Effect::Allow }, stream);
+    wire::encode_response({ 8, wire::Status::Malformed, Effect::Deny }, stream);
+    ASSERT_EQ("fixed-size frames", 2 * (wire::kHeaderSize + wire::kResponsePayload), stream.size());
+
+    // Pipelined frames are read back in order from one buffer.
+    std::vector<wire::Response> responses;
+    std::size_t pos = 0;
+    while (auto length = wire::payload_length(stream.data() + pos, stream.size() - pos)) {
+        wire::Response r;
+        if (!wire::decode_response(stream.data() + pos + wire::kHeaderSize, *length, r)) break;
+        responses.push_back(r);
+        pos += wire::kHeaderSize + *length;
+    }
+    ASSERT_EQ("two responses", static_cast<std::size_t>(2), responses.size());
+    ASSERT_EQ("first id", static_cast<std::uint32_t>(7), responses[0].id);
+    ASSERT_EQ("first effect", Effect::Allow, responses[0].effect);
+    ASSERT_TRUE("second status", responses[1].status == wire::Status::Malformed);
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main() {
+    std::cout << "=== Wire Protocol Tests ===\n";
+
+    test_request_round_trip();
+    test_untrusted_input();
+    test_response_round_trip();
+
+    std::cout << "\n--- Results: "
+              << passed << " passed, " << failed << " failed ---\n";
+    return failed == 0 ? 0 : 1;
+}
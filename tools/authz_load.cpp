@@ -0,0 +1,329 @@
+// governance_authz_load: load generator for governance_authzd.
+//
+// Opens --connections connections, one thread each, and keeps --pipeline
+// requests in flight on every connection until --requests responses have
+// arrived per connection. Reports throughput and round-trip latency
+// percentiles. With --spawn BINARY it starts the daemon on a private socket
+// first and stops it afterwards, which is how the CTest smoke test runs.
+// With --shm each connection is a shared-memory channel handed to the
+// daemon's --shm-socket instead.
+
+#include "governance/shm_transport.hpp"
+#include "governance/wire.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace governance;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Options {
+    std::string socket_path = "/tmp/governance_authzd.sock";
+    std::string spawn;                 // daemon binary to start, if any
+    std::string shm_socket;            // use shared-memory channels, if set
+    std::size_t connections = 4;
+    std::size_t pipeline    = 16;      // requests in flight per connection
+    std::size_t requests    = 100000;  // per connection
+};
+
+// The same request mix as governance_bench: every built-in policy fires.
+std::vector<RequestContext> request_mix() {
+    Resource patient_db  { "db-patient-records",  "database", "restricted",   {} };
+    Resource public_docs { "storage-public-docs", "storage",  "public",       {} };
+    Resource prod_api    { "compute-prod-api",    "compute",  "confidential", {} };
+
+    Principal alice { "alice@corp.io", "admin",    "IT"         };
+    Principal bob   { "bob@corp.io",   "engineer", "Backend"    };
+    Principal carol { "carol@corp.io", "analyst",  "DataSci"    };
+    Principal dave  { "dave@corp.io",  "guest",    "Consulting" };
+
+    return {
+        { alice, patient_db,  {"read"},  "production", true  },
+        { bob,   prod_api,    {"write"}, "production", false },
+        { bob,   prod_api,    {"read"},  "production", false },
+        { bob,   prod_api,    {"write"}, "staging",    false },
+        { carol, public_docs, {"read"},  "dev",        false },
+        { carol, patient_db,  {"read"},  "production", true  },
+        { dave,  public_docs, {"read"},  "dev",        false },
+        { bob,   patient_db,  {"read"},  "staging",    true  },
+    };
+}
+
+int connect_to(const std::string& path) {
+    sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool write_all(int fd, const std::vector<std::uint8_t>& data) {
+    std::size_t sent = 0;
+    while (sent < data.size()) {
+        const ssize_t n = ::write(fd, data.data() + sent, data.size() - sent);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        sent += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+// ── Client ───────────────────────────────────────────────────────────────────
+
+struct ClientResult {
+    std::vector<double> latencies_ns;
+    std::size_t         errors = 0;
+};
+
+void run_client(const Options& options, const std::vector<RequestContext>& mix,
+                ClientResult& result) {
+    const int fd = connect_to(options.socket_path);
+    if (fd < 0) {
+        result.errors = options.requests;
+        return;
+    }
+
+    // Pre-encode the mix; request ids index `sent_at` modulo the pipeline depth.
+    std::vector<std::vector<std::uint8_t>> encoded(mix.size());
+    std::vector<Clock::time_point> sent_at(options.pipeline);
+    result.latencies_ns.reserve(options.requests);
+
+    std::uint32_t next_id  = 0;
+    std::size_t   received = 0;
+    std::vector<std::uint8_t> out;
+    auto enqueue = [&] {
+        const std::uint32_t id = next_id++;
+        wire::encode_request(id, mix[id % mix.size()], out);
+        sent_at[id % options.pipeline] = Clock::now();
+    };
+
+    for (std::size_t i = 0; i < std::min(options.pipeline, options.requests); ++i) enqueue();
+    if (!write_all(fd, out)) result.errors = options.requests;
+
+    std::vector<std::uint8_t> in(64 * 1024);
+    std::size_t in_len = 0;
+    while (result.errors == 0 && received < options.requests) {
+        const ssize_t n = ::read(fd, in.data() + in_len, in.size() - in_len);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) continue;
+            result.errors += options.requests - received;
+            break;
+        }
+        in_len += static_cast<std::size_t>(n);
+
+        const auto now = Clock::now();
+        out.clear();
+        std::size_t pos = 0;
+        while (auto length = wire::payload_length(in.data() + pos, in_len - pos)) {
+            if (in_len - pos < wire::kHeaderSize + *length) break;
+            wire::Response response;
+            if (!wire::decode_response(in.data() + pos + wire::kHeaderSize, *length, response) ||
+                response.status != wire::Status::Ok) {
+                ++result.errors;
+            }
+            result.latencies_ns.push_back(std::chrono::duration<double, std::nano>(
+                now - sent_at[response.id % options.pipeline]).count());
+            ++received;
+            pos += wire::kHeaderSize + *length;
+            if (next_id < options.requests) enqueue();
+        }
+        std::memmove(in.data(), in.data() + pos, in_len - pos);
+        in_len -= pos;
+        if (!out.empty() && !write_all(fd, out)) {
+            result.errors += options.requests - received;
+            break;
+        }
+    }
+    ::close(fd);
+}
+
+void run_shm_client(const Options& options, const std::vector<RequestContext>& mix,
+                    ClientResult& result) {
+    std::optional<ShmClient> client;
+    try {
+        client.emplace(ShmClient::connect(options.shm_socket));
+    } catch (const std::exception& e) {
+        std::cerr << "governance_authz_load: " << e.what() << "\n";
+        result.errors = options.requests;
+        return;
+    }
+
+    std::vector<Clock::time_point> sent_at(options.pipeline);
+    result.latencies_ns.reserve(options.requests);
+
+    std::uint32_t next_id  = 0;
+    std::size_t   received = 0;
+    Backoff       backoff;
+    wire::Response response;
+    while (received < options.requests) {
+        // Top the pipeline up, then publish the whole batch at once.
+        while (next_id < options.requests && next_id - received < options.pipeline &&
+               client->submit(next_id, mix[next_id % mix.size()])) {
+            sent_at[next_id % options.pipeline] = Clock::now();
+            ++next_id;
+        }
+        client->flush();
+
+        if (!client->poll(response)) {
+            if (backoff.sleeping() && client->server_gone()) {
+                std::cerr << "governance_authz_load: shared-memory server went away\n";
+                result.errors += options.requests - received;
+                return;
+            }
+            backoff.pause();
+            continue;
+        }
+        backoff.reset();
+        const auto now = Clock::now();
+        do {
+            if (response.status != wire::Status::Ok) ++result.errors;
+            result.latencies_ns.push_back(std::chrono::duration<double, std::nano>(
+                now - sent_at[response.id % options.pipeline]).count());
+            ++received;
+        } while (client->poll(response));
+    }
+}
+
+// ── Daemon management ────────────────────────────────────────────────────────
+
+pid_t spawn_daemon(const Options& options) {
+    const pid_t pid = ::fork();
+    if (pid == 0) {
+        if (options.shm_socket.empty()) {
+            ::execl(options.spawn.c_str(), options.spawn.c_str(),
+                    "--socket", options.socket_path.c_str(), "--threads", "2", nullptr);
+        } else {
+            ::execl(options.spawn.c_str(), options.spawn.c_str(),
+                    "--socket", options.socket_path.c_str(), "--threads", "1",
+                    "--shm-socket", options.shm_socket.c_str(), nullptr);
+        }
+        std::_Exit(127);
+    }
+    // Wait for the socket to accept connections.
+    const std::string& ready = options.shm_socket.empty() ? options.socket_path : options.shm_socket;
+    for (int attempt = 0; attempt < 500; ++attempt) {
+        const int fd = connect_to(ready);
+        if (fd >= 0) {
+            ::close(fd);
+            return pid;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ::kill(pid, SIGKILL);
+    return -1;
+}
+
+double percentile(std::vector<double>& values, double q) {
+    if (values.empty()) return 0.0;
+    const auto k = static_cast<std::size_t>(q * static_cast<double>(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(k), values.end());
+    return values[k];
+}
+
+void usage(const char* argv0) {
+    std::cerr << "usage: " << argv0 << " [--socket PATH] [--connections N] [--pipeline N]\n"
+              << "       [--requests N] [--shm] [--shm-socket PATH] [--spawn DAEMON_BINARY]\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg  = argv[i];
+        const bool  more = i + 1 < argc;
+        if (std::strcmp(arg, "--socket") == 0 && more) {
+            options.socket_path = argv[++i];
+        } else if (std::strcmp(arg, "--connections") == 0 && more) {
+            options.connections = std::max(1ul, std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--pipeline") == 0 && more) {
+            options.pipeline = std::max(1ul, std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--requests") == 0 && more) {
+            options.requests = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--shm") == 0) {
+            if (options.shm_socket.empty()) options.shm_socket = "/tmp/governance_authzd.shm.sock";
+        } else if (std::strcmp(arg, "--shm-socket") == 0 && more) {
+            options.shm_socket = argv[++i];
+        } else if (std::strcmp(arg, "--spawn") == 0 && more) {
+            options.spawn = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    pid_t daemon = 0;
+    if (!options.spawn.empty()) {
+        const std::string prefix = "/tmp/governance_authz_load." + std::to_string(::getpid());
+        options.socket_path = prefix + ".sock";
+        if (!options.shm_socket.empty()) options.shm_socket = prefix + ".shm.sock";
+        daemon = spawn_daemon(options);
+        if (daemon < 0) {
+            std::cerr << "governance_authz_load: daemon did not start\n";
+            return 1;
+        }
+    }
+
+    const auto mix = request_mix();
+    std::vector<ClientResult> results(options.connections);
+    std::vector<std::thread>  clients;
+    const auto start = Clock::now();
+    for (std::size_t c = 0; c < options.connections; ++c)
+        clients.emplace_back([&, c] {
+            if (options.shm_socket.empty()) {
+                run_client(options, mix, results[c]);
+            } else {
+                run_shm_client(options, mix, results[c]);
+            }
+        });
+    for (auto& t : clients) t.join();
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    if (daemon > 0) {
+        ::kill(daemon, SIGTERM);
+        ::waitpid(daemon, nullptr, 0);
+    }
+
+    std::vector<double> latencies;
+    std::size_t errors = 0;
+    for (auto& r : results) {
+        latencies.insert(latencies.end(), r.latencies_ns.begin(), r.latencies_ns.end());
+        errors += r.errors;
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << (options.shm_socket.empty() ? "socket" : "shm") << "  "
+              << "connections " << options.connections
+              << "  pipeline " << options.pipeline
+              << "  responses " << latencies.size()
+              << "  errors " << errors << "\n"
+              << "throughput  " << static_cast<double>(latencies.size()) / seconds / 1000.0 << " k req/s\n"
+              << "round trip  p50 " << percentile(latencies, 0.50) / 1000.0
+              << " us  p99 "  << percentile(latencies, 0.99) / 1000.0
+              << " us  p999 " << percentile(latencies, 0.999) / 1000.0 << " us\n";
+    return errors == 0 ? 0 : 1;
+}
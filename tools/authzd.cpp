@@ -0,0 +1,420 @@
+// governance_authzd: serves PolicyEngine decisions over a Unix domain socket.
+//
+// One worker thread per core, each with its own epoll instance. Every worker
+// watches the listening socket (EPOLLEXCLUSIVE, so a new connection wakes one
+// of them) and owns the connections it accepts, so a request is read,
+// decided and answered on one thread without handoffs. Clients may pipeline:
+// every complete frame in a read is answered, and the responses go out in a
+// single write. The wire format is documented in governance/wire.hpp.
+//
+// With --shm-socket, co-located clients may instead hand over a shared-memory
+// channel (governance/shm_transport.hpp); each channel is served by its own
+// busy-polling thread until the client detaches or disconnects.
+
+#include "governance/decision_cache.hpp"
+#include "governance/policy_engine.hpp"
+#include "governance/shm_transport.hpp"
+#include "governance/wire.hpp"
+
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace governance;
+
+namespace {
+
+struct Options {
+    std::string socket_path = "/tmp/governance_authzd.sock";
+    std::size_t threads     = 0;   // 0: one per hardware thread
+    std::size_t cache       = 0;   // decision cache capacity; 0 disables it
+    std::string shm_socket;        // accepts shared-memory channels, if set
+};
+
+int g_stop_fd = -1;
+
+void on_signal(int) {
+    const std::uint64_t one = 1;
+    // write() is async-signal-safe; the result only matters to the workers.
+    [[maybe_unused]] auto n = ::write(g_stop_fd, &one, sizeof(one));
+}
+
+[[noreturn]] void die(const char* what) {
+    std::cerr << "governance_authzd: " << what << ": " << std::strerror(errno) << "\n";
+    std::exit(1);
+}
+
+// ── Connection ───────────────────────────────────────────────────────────────
+
+constexpr std::size_t kReadChunk  = 64 * 1024;
+constexpr std::size_t kMaxPending = 4 * 1024 * 1024;   // unsent response bytes
+
+struct Connection {
+    int                       fd = -1;
+    std::vector<std::uint8_t> in;          // received bytes [0, in_len)
+    std::size_t               in_len = 0;
+    std::vector<std::uint8_t> out;         // responses [out_sent, out.size())
+    std::size_t               out_sent = 0;
+    bool                      writing  = false;   // EPOLLOUT registered
+    RequestContext            ctx;                // reused for every request
+};
+
+// ── Worker ───────────────────────────────────────────────────────────────────
+
+class Worker {
+public:
+    Worker(const PolicyEngine& engine, int listen_fd, int stop_fd)
+        : engine_(engine), listen_fd_(listen_fd) {
+        epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd_ < 0) die("epoll_create1");
+        watch(listen_fd, EPOLLIN | EPOLLEXCLUSIVE, nullptr);
+        watch(stop_fd, EPOLLIN, &stop_tag_);
+    }
+
+    ~Worker() {
+        for (auto& [fd, conn] : connections_) ::close(fd);
+        ::close(epoll_fd_);
+    }
+
+    void run() {
+        epoll_event events[64];
+        for (;;) {
+            const int n = ::epoll_wait(epoll_fd_, events, 64, -1);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                die("epoll_wait");
+            }
+            for (int i = 0; i < n; ++i) {
+                void* tag = events[i].data.ptr;
+                if (tag == &stop_tag_) return;
+                if (tag == nullptr) {
+                    accept_all();
+                    continue;
+                }
+                auto* conn = static_cast<Connection*>(tag);
+                if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                    close(conn);
+                    continue;
+                }
+                if ((events[i].events & EPOLLOUT) && !flush(conn)) continue;
+                if (events[i].events & (EPOLLIN | EPOLLRDHUP)) serve(conn);
+            }
+        }
+    }
+
+private:
+    void watch(int fd, std::uint32_t events, void* tag) {
+        epoll_event ev {};
+        ev.events   = events;
+        ev.data.ptr = tag;
+        if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &ev) < 0) die("epoll_ctl");
+    }
+
+    void accept_all() {
+        for (;;) {
+            const int fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) return;   // EAGAIN, or another worker took it
+            auto conn = std::make_unique<Connection>();
+            conn->fd = fd;
+            conn->in.resize(kReadChunk);
+            watch(fd, EPOLLIN | EPOLLRDHUP | EPOLLET, conn.get());
+            connections_.emplace(fd, std::move(conn));
+        }
+    }
+
+    // Reads until EAGAIN, answering every complete frame. Returns false if
+    // the connection was closed.
+    bool serve(Connection* conn) {
+        for (;;) {
+            if (conn->out.size() - conn->out_sent > kMaxPending) return true;   // resumed by flush()
+            if (conn->in_len == conn->in.size()) conn->in.resize(conn->in.size() * 2);
+
+            const ssize_t n = ::read(conn->fd, conn->in.data() + conn->in_len,
+                                     conn->in.size() - conn->in_len);
+            if (n == 0) {
+                close(conn);
+                return false;
+            }
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) return true;
+                close(conn);
+                return false;
+            }
+            conn->in_len += static_cast<std::size_t>(n);
+            if (!answer(conn) || !flush(conn)) return false;
+        }
+    }
+
+    // Decides every complete frame in the input buffer. Returns false if the
+    // connection was closed for sending an oversized frame.
+    bool answer(Connection* conn) {
+        std::size_t pos = 0;
+        while (auto length = wire::payload_length(conn->in.data() + pos, conn->in_len - pos)) {
+            if (*length > wire::kMaxPayload) {
+                close(conn);
+                return false;
+            }
+            if (conn->in_len - pos < wire::kHeaderSize + *length) break;
+
+            const std::uint8_t* payload = conn->in.data() + pos + wire::kHeaderSize;
+            wire::Response response;
+            // A request that cannot be decided is denied; it must not take
+            // the worker, and every connection it serves, down with it.
+            try {
+                if (wire::decode_request(payload, *length, response.id, conn->ctx)) {
+                    response.effect = engine_.decide(conn->ctx);
+                } else {
+                    response.status = wire::Status::Malformed;
+                }
+            } catch (const std::exception&) {
+                response.status = wire::Status::Malformed;
+                response.effect = Effect::Deny;
+            }
+            wire::encode_response(response, conn->out);
+            pos += wire::kHeaderSize + *length;
+        }
+        // Keep the partial frame, if any, at the front of the buffer.
+        std::memmove(conn->in.data(), conn->in.data() + pos, conn->in_len - pos);
+        conn->in_len -= pos;
+        return true;
+    }
+
+    // Writes pending responses. Returns false if the connection was closed.
+    bool flush(Connection* conn) {
+        while (conn->out_sent < conn->out.size()) {
+            const ssize_t n = ::write(conn->fd, conn->out.data() + conn->out_sent,
+                                      conn->out.size() - conn->out_sent);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    set_writing(conn, true);
+                    return true;
+                }
+                close(conn);
+                return false;
+            }
+            conn->out_sent += static_cast<std::size_t>(n);
+        }
+
+        const bool was_throttled = conn->out.size() > kMaxPending;
+        conn->out.clear();
+        conn->out_sent = 0;
+        set_writing(conn, false);
+        // serve() stops reading while too much output is pending; with edge
+        // triggering no new event will arrive for data already queued.
+        return was_throttled ? serve(conn) : true;
+    }
+
+    void set_writing(Connection* conn, bool writing) {
+        if (conn->writing == writing) return;
+        epoll_event ev {};
+        ev.events   = EPOLLIN | EPOLLRDHUP | EPOLLET | (writing ? EPOLLOUT : 0u);
+        ev.data.ptr = conn;
+        ::epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, conn->fd, &ev);
+        conn->writing = writing;
+    }
+
+    void close(Connection* conn) {
+        const int fd = conn->fd;
+        ::close(fd);                 // also removes it from the epoll set
+        connections_.erase(fd);      // destroys conn
+    }
+
+    const PolicyEngine& engine_;
+    int                 listen_fd_;
+    int                 epoll_fd_ = -1;
+    char                stop_tag_ = 0;
+    std::unordered_map<int, std::unique_ptr<Connection>> connections_;
+};
+
+// ── Shared-memory channels ───────────────────────────────────────────────────
+
+// Receives the memfd a ShmClient sends with its one-byte hello, or -1.
+int receive_channel_fd(int conn) {
+    char byte;
+    iovec iov { &byte, 1 };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr msg {};
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control;
+    msg.msg_controllen = sizeof(control);
+    if (::recvmsg(conn, &msg, MSG_CMSG_CLOEXEC) != 1) return -1;
+
+    const cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    if (!cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS ||
+        cmsg->cmsg_len != CMSG_LEN(sizeof(int))) {
+        return -1;
+    }
+    int fd;
+    std::memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+    return fd;
+}
+
+// One channel's serving thread. `done` is set as the thread finishes, so the
+// accept loop can join it without waiting.
+struct ChannelServer {
+    std::atomic<bool> done { false };
+    std::thread       thread;
+};
+
+// Accepts channel handovers until `stop_fd` fires, serving each on its own
+// thread. The client's connection stays open as a liveness signal. Threads
+// of channels that have ended are joined on every pass of the accept loop,
+// so clients that come and go do not accumulate threads.
+void serve_channels(const PolicyEngine& engine, int listen_fd, int stop_fd) {
+    std::atomic<bool>         stop { false };
+    std::list<ChannelServer>  servers;   // stable addresses for `done`
+
+    const auto reap = [&servers] {
+        for (auto it = servers.begin(); it != servers.end();) {
+            if (it->done.load(std::memory_order_acquire)) {
+                it->thread.join();
+                it = servers.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    };
+
+    pollfd fds[2] = { { listen_fd, POLLIN, 0 }, { stop_fd, POLLIN, 0 } };
+    while (!(fds[1].revents & POLLIN)) {
+        if (::poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            die("poll");
+        }
+        reap();
+        if (!(fds[0].revents & POLLIN)) continue;
+
+        const int conn = ::accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (conn < 0) continue;
+        // A client that connects but never sends must not stall the handover.
+        const timeval timeout { 1, 0 };
+        ::setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        const int fd = receive_channel_fd(conn);
+        if (fd < 0) {   // e.g. a readiness probe
+            ::close(conn);
+            continue;
+        }
+        try {
+            auto channel = ShmChannel::attach(fd);
+            const char ok = 1;
+            if (::write(conn, &ok, 1) != 1) throw std::runtime_error("handshake failed");
+            ChannelServer& server = servers.emplace_back();
+            server.thread = std::thread([&engine, &stop, &server, conn, c = std::move(channel)]() mutable {
+                // A failure ends this channel only, never the daemon.
+                try {
+                    ShmServer(engine, std::move(c), conn).run(stop);
+                } catch (const std::exception& e) {
+                    std::cerr << "governance_authzd: shared-memory channel closed: " << e.what() << "\n";
+                }
+                ::close(conn);
+                server.done.store(true, std::memory_order_release);
+            });
+        } catch (const std::exception& e) {
+            std::cerr << "governance_authzd: rejected shared-memory channel: " << e.what() << "\n";
+            if (!servers.empty() && !servers.back().thread.joinable()) servers.pop_back();
+            ::close(conn);
+        }
+    }
+
+    stop = true;
+    for (auto& s : servers) s.thread.join();
+}
+
+// ── Setup ────────────────────────────────────────────────────────────────────
+
+int listen_on(const std::string& path) {
+    sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "governance_authzd: socket path too long\n";
+        std::exit(2);
+    }
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) die("socket");
+    ::unlink(path.c_str());
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) die("bind");
+    if (::listen(fd, SOMAXCONN) < 0) die("listen");
+    return fd;
+}
+
+void usage(const char* argv0) {
+    std::cerr << "usage: " << argv0 << " [--socket PATH] [--threads N] [--cache ENTRIES]\n"
+              << "       [--shm-socket PATH]\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg  = argv[i];
+        const bool  more = i + 1 < argc;
+        if (std::strcmp(arg, "--socket") == 0 && more) {
+            options.socket_path = argv[++i];
+        } else if (std::strcmp(arg, "--threads") == 0 && more) {
+            options.threads = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--cache") == 0 && more) {
+            options.cache = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--shm-socket") == 0 && more) {
+            options.shm_socket = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (options.threads == 0) options.threads = std::max(1u, std::thread::hardware_concurrency());
+
+    auto engine = default_policy_engine();
+    if (options.cache) engine.enable_cache(options.cache, DecisionCache::kShardPerCore);
+
+    g_stop_fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (g_stop_fd < 0) die("eventfd");
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    const int listen_fd = listen_on(options.socket_path);
+    std::cerr << "governance_authzd: listening on " << options.socket_path
+              << " with " << options.threads << " worker(s)\n";
+
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < options.threads; ++i) {
+        workers.emplace_back([&] { Worker(engine, listen_fd, g_stop_fd).run(); });
+    }
+    if (!options.shm_socket.empty()) {
+        const int shm_fd = listen_on(options.shm_socket);
+        std::cerr << "governance_authzd: accepting shared-memory channels on "
+                  << options.shm_socket << "\n";
+        serve_channels(engine, shm_fd, g_stop_fd);   // returns on SIGINT/SIGTERM
+        ::close(shm_fd);
+        ::unlink(options.shm_socket.c_str());
+    }
+    for (auto& w : workers) w.join();
+
+    ::close(listen_fd);
+    ::unlink(options.socket_path.c_str());
+    return 0;
+}
@@ -0,0 +1,115 @@
+// governance_snapshot_write: converts a JSONL inventory export into a binary
+// snapshot that governance_scan --snapshot and InventorySnapshot can map.
+//
+// Reads one Resource per line from --input (default: stdin) and writes the
+// snapshot to --output. The writer packs each resource as it is read, so
+// memory grows with the snapshot, not with the parsed Resources.
+//
+// Malformed lines are reported on stderr; by default the conversion stops at
+// the first one and writes nothing, with --keep-going it skips them. Exit
+// status: 0 on success, 1 if any line was rejected or a file could not be
+// read or written, 2 on usage errors.
+
+#include "governance/inventory_snapshot.hpp"
+#include "governance/resource_reader.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace governance;
+
+namespace {
+
+struct Options {
+    std::string input = "-";
+    std::string output;
+    bool        keep_going = false;
+};
+
+void usage(const char* argv0) {
+    std::cerr << "usage: " << argv0 << " [--input FILE|-] --output FILE [--keep-going]\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg  = argv[i];
+        const bool  more = i + 1 < argc;
+        if (std::strcmp(arg, "--input") == 0 && more) {
+            options.input = argv[++i];
+        } else if (std::strcmp(arg, "--output") == 0 && more) {
+            options.output = argv[++i];
+        } else if (std::strcmp(arg, "--keep-going") == 0) {
+            options.keep_going = true;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (options.output.empty()) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::ifstream file;
+    if (options.input != "-") {
+        file.open(options.input, std::ios::binary);
+        if (!file) {
+            std::cerr << "governance_snapshot_write: cannot open " << options.input << "\n";
+            return 1;
+        }
+    }
+    std::istream& in = options.input == "-" ? std::cin : file;
+
+    ResourceReader reader(in);
+    SnapshotWriter writer;
+    Resource       resource;
+    std::size_t    rejected = 0;
+    try {
+        for (;;) {
+            try {
+                if (!reader.next(resource)) break;
+            } catch (const std::runtime_error& e) {
+                std::cerr << "governance_snapshot_write: " << e.what() << "\n";
+                ++rejected;
+                if (options.keep_going) continue;
+                return 1;
+            }
+            writer.add(resource);
+        }
+    } catch (const std::length_error& e) {
+        std::cerr << "governance_snapshot_write: " << e.what() << "\n";
+        return 1;
+    }
+
+    // Written beside the target and renamed over it, so a reader never maps
+    // a half-written snapshot.
+    const std::string partial = options.output + ".partial";
+    try {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("cannot create " + partial);
+        writer.write(out);
+        out.close();
+        if (!out) throw std::runtime_error("cannot write " + partial);
+    } catch (const std::runtime_error& e) {
+        std::cerr << "governance_snapshot_write: " << e.what() << "\n";
+        std::remove(partial.c_str());
+        return 1;
+    }
+    if (std::rename(partial.c_str(), options.output.c_str()) != 0) {
+        std::cerr << "governance_snapshot_write: cannot rename " << partial << " to " << options.output << "\n";
+        std::remove(partial.c_str());
+        return 1;
+    }
+
+    std::cerr << "governance_snapshot_write: " << writer.size() << " resource(s) written";
+    if (rejected) std::cerr << ", " << rejected << " line(s) rejected";
+    std::cerr << "\n";
+    return rejected == 0 ? 0 : 1;
+}